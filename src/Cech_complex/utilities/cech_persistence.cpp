@@ -61,16 +61,15 @@ int main(int argc, char* argv[]) {
   // initializes the coefficient field for homology
   pcoh.init_coefficients(p);
 
-  pcoh.compute_persistent_cohomology(min_persistence);
-
-  // Output the diagram in filediag
-  if (filediag.empty()) {
-    pcoh.output_diagram();
-  } else {
-    std::ofstream out(filediag);
-    pcoh.output_diagram(out);
-    out.close();
+  // Output the diagram in filediag, each interval as soon as it is computed
+  std::ofstream out;
+  if (!filediag.empty()) {
+    out.open(filediag);
   }
+  std::ostream& diagram = filediag.empty() ? std::cout : out;
+  pcoh.compute_persistent_cohomology(min_persistence, [&](const auto& interval) {
+    pcoh.output_interval(diagram, interval);
+  });
 
   return 0;
 }
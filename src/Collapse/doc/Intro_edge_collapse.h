@@ -0,0 +1,67 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef DOC_EDGE_COLLAPSE_INTRO_EDGE_COLLAPSE_H_
+#define DOC_EDGE_COLLAPSE_INTRO_EDGE_COLLAPSE_H_
+
+// needs namespace for Doxygen to link on classes
+namespace Gudhi {
+
+namespace collapse {
+
+/**  \defgroup edge_collapse Edge collapse
+ * 
+ * \author    Siddharth Pritam
+ * 
+ * @{
+ * 
+ * \section edge_collapse_definition Edge collapse definition
+ * 
+ * An edge \f$e\f$ in a simplicial complex \f$K\f$ is called a <b>dominated edge</b> if the link of \f$e\f$ in
+ * \f$K\f$, \f$lk_K(e)\f$ is a simplicial cone, that is, there exists a vertex \f$v^{\prime} \notin e\f$ and a
+ * subcomplex \f$L\f$ in \f$K\f$, such that \f$lk_K(e) = v^{\prime}L\f$. We say that the vertex \f$v^{\prime}\f$ is
+ * the dominating vertex of \f$e\f$. In a flag complex, this means that \f$v^{\prime}\f$ is adjacent to the two
+ * vertices of \f$e\f$ and to all their other common neighbors.
+ * Removing a dominated edge and all its cofaces is called an <b>elementary strong collapse</b>, and preserves the
+ * homotopy type of the flag complex.
+ *
+ * For a flag filtration, the edges are processed from the last one to the first one. An edge dominated from its
+ * filtration value until some time can be inserted at that time instead, and an edge that stays dominated forever can
+ * be removed, without changing the persistence diagram \cite edgecollapsesocg2020. Since a Rips complex is in general
+ * made mostly of dominated edges, the flag complex of the remaining edges is much smaller and its expansion is much
+ * cheaper, both in time and in memory.
+ *
+ * `flag_complex_collapse_edges` works on a range of filtered edges, and `flag_complex_collapse_edges_of_graph` on
+ * the 1-skeleton graph given to `Simplex_tree::insert_graph`, e.g. the one returned by
+ * `Gudhi::compute_proximity_graph`. The vertices and their filtration values are not modified. Only the persistence
+ * of the full flag complex is preserved: when the expansion is limited to a dimension \f$d\f$, the persistence is the
+ * same in dimension strictly less than \f$d\f$.
+ *
+ * \section edge_collapse_example Example of edge collapse before a Rips persistence computation
+ *
+ * This example computes the Rips 1-skeleton of points read from an OFF file, collapses its edges, expands the
+ * remaining graph and computes its persistence, which is the one of the Rips complex.
+ *
+ * \include Collapse/edge_collapse_rips_persistence.cpp
+ * 
+ * When launching:
+ * 
+ * \code $> ./Collapse_example_edge_collapse_rips_persistence ../../data/points/tore3D_300.off 0.8 3
+ * \endcode
+ *
+ * the program outputs the sizes of the graph before and after the collapse, followed by the persistence diagram.
+ */
+/** @} */  // end defgroup edge_collapse
+
+}  // namespace collapse
+
+}  // namespace Gudhi
+
+#endif  // DOC_EDGE_COLLAPSE_INTRO_EDGE_COLLAPSE_H_
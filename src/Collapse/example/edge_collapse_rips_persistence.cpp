@@ -0,0 +1,55 @@
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Points_off_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+void usage(int nbArgs, char * const progName) {
+  std::cerr << "Error: Number of arguments (" << nbArgs << ") is not correct\n";
+  std::cerr << "Usage: " << progName << " filename.off threshold dim_max\n";
+  std::cerr << "       i.e.: " << progName << " ../../data/points/tore3D_300.off 0.8 3\n";
+  exit(-1);  // ----- >>
+}
+
+int main(int argc, char **argv) {
+  if (argc != 4) usage(argc, (argv[0] - 1));
+
+  std::string off_file_name(argv[1]);
+  double threshold = atof(argv[2]);
+  int dim_max = atoi(argv[3]);
+
+  // Type definitions
+  using Point = std::vector<double>;
+  using Simplex_tree = Gudhi::Simplex_tree<>;
+  using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+  using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
+
+  // ----------------------------------------------------------------------------
+  // Rips 1-skeleton of a point cloud, collapsed before the expansion
+  // ----------------------------------------------------------------------------
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+  auto skeleton = Gudhi::compute_proximity_graph<Simplex_tree>(off_reader.get_point_cloud(), threshold,
+                                                               Gudhi::Euclidean_distance());
+  auto collapsed_skeleton = Gudhi::collapse::flag_complex_collapse_edges_of_graph(skeleton);
+  std::cout << "The Rips 1-skeleton has " << boost::num_edges(skeleton) << " edges, " <<
+               boost::num_edges(collapsed_skeleton) << " remain after edge collapse." << std::endl;
+
+  Simplex_tree stree;
+  stree.insert_graph(collapsed_skeleton);
+  stree.expansion(dim_max);
+  std::cout << "The collapsed Rips complex is of dimension " << stree.dimension() << " - " <<
+               stree.num_simplices() << " simplices - " << stree.num_vertices() << " vertices." << std::endl;
+
+  // The persistence is the one of the Rips complex, up to dimension dim_max - 1
+  Persistent_cohomology pcoh(stree);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  pcoh.output_diagram();
+
+  return 0;
+}
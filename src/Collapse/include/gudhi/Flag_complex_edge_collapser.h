@@ -0,0 +1,250 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef FLAG_COMPLEX_EDGE_COLLAPSER_H_
+#define FLAG_COMPLEX_EDGE_COLLAPSER_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>  // for std::sort, std::lower_bound, std::max
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>  // for std::pair
+#include <vector>
+
+namespace Gudhi {
+
+namespace collapse {
+
+/** \private
+ *
+ * \brief Edge collapser of a flag filtration, see `flag_complex_collapse_edges`.
+ *
+ * The edges are processed by decreasing filtration value. An edge \f$uv\f$ is dominated at time \f$t\f$ if there is a
+ * common neighbor \f$w\f$ of \f$u\f$ and \f$v\f$ adjacent to all the other common neighbors, in the graph made of the
+ * edges of filtration value at most \f$t\f$. An edge dominated from its filtration value until some time can be
+ * delayed until then, and an edge that stays dominated forever can be removed, without changing the persistence.
+ */
+template <typename Vertex, typename Filtration_value>
+class Flag_complex_edge_collapser {
+ public:
+  using Filtered_edge = std::tuple<Vertex, Vertex, Filtration_value>;
+
+  template <class FilteredEdgeRange>
+  explicit Flag_complex_edge_collapser(const FilteredEdgeRange& edges) {
+    std::size_t num_vertices = 0;
+    for (auto&& edge : edges)
+      num_vertices = std::max<std::size_t>(num_vertices, std::max(std::get<0>(edge), std::get<1>(edge)) + 1);
+    neighbors_.resize(num_vertices);
+    for (auto&& edge : edges) {
+      Vertex u = std::get<0>(edge);
+      Vertex v = std::get<1>(edge);
+      if (u == v) continue;
+      neighbors_[u].emplace_back(v, std::get<2>(edge));
+      neighbors_[v].emplace_back(u, std::get<2>(edge));
+    }
+    // Sort the neighbors and keep the smallest filtration value of duplicated edges
+    for (Vertex u = 0; u < static_cast<Vertex>(num_vertices); ++u) {
+      auto& ngb = neighbors_[u];
+      std::sort(ngb.begin(), ngb.end());
+      ngb.erase(std::unique(ngb.begin(), ngb.end(),
+                            [](const Neighbor& a, const Neighbor& b) { return a.first == b.first; }),
+                ngb.end());
+      for (const Neighbor& n : ngb)
+        if (u < n.first) edges_.emplace_back(u, n.first, n.second);
+    }
+    std::stable_sort(edges_.begin(), edges_.end(), [](const Filtered_edge& a, const Filtered_edge& b) {
+      return std::get<2>(a) < std::get<2>(b);
+    });
+  }
+
+  /** \brief Returns the remaining edges, with their possibly increased filtration values, sorted by filtration. */
+  std::vector<Filtered_edge> collapse() {
+    std::vector<Filtered_edge> remaining_edges;
+    std::vector<Vertex> common;
+    std::vector<std::pair<Filtration_value, Vertex>> later;
+    for (auto edge = edges_.rbegin(); edge != edges_.rend(); ++edge) {
+      Vertex u = std::get<0>(*edge);
+      Vertex v = std::get<1>(*edge);
+      Filtration_value time = std::get<2>(*edge);
+
+      // Common neighbors of u and v, with the time at which they become common.
+      common.clear();
+      later.clear();
+      auto u_it = neighbors_[u].begin();
+      auto v_it = neighbors_[v].begin();
+      while (u_it != neighbors_[u].end() && v_it != neighbors_[v].end()) {
+        if (u_it->first < v_it->first) {
+          ++u_it;
+        } else if (v_it->first < u_it->first) {
+          ++v_it;
+        } else {
+          Filtration_value common_time = std::max(u_it->second, v_it->second);
+          if (common_time <= time)
+            common.push_back(u_it->first);
+          else
+            later.emplace_back(common_time, u_it->first);
+          ++u_it;
+          ++v_it;
+        }
+      }
+      std::sort(later.begin(), later.end());
+
+      auto next = later.begin();
+      bool dominated_forever = false;
+      while (true) {
+        const Vertex* dominator = find_dominator(common, time);
+        if (dominator == nullptr) break;
+        // The dominator remains one as long as the new common neighbors are already adjacent to it.
+        Vertex w = *dominator;
+        for (; next != later.end(); ++next) {
+          const Neighbor* wx = find_neighbor(w, next->second);
+          if (wx == nullptr || next->first < wx->second) break;
+          insert_sorted(common, next->second);
+        }
+        if (next == later.end()) {
+          dominated_forever = true;
+          break;
+        }
+        time = next->first;
+        for (; next != later.end() && next->first <= time; ++next)
+          insert_sorted(common, next->second);
+      }
+
+      if (dominated_forever) {
+        remove_neighbor(u, v);
+        remove_neighbor(v, u);
+      } else {
+        find_neighbor(u, v)->second = time;
+        find_neighbor(v, u)->second = time;
+        remaining_edges.emplace_back(u, v, time);
+      }
+    }
+    std::stable_sort(remaining_edges.begin(), remaining_edges.end(),
+                     [](const Filtered_edge& a, const Filtered_edge& b) { return std::get<2>(a) < std::get<2>(b); });
+    return remaining_edges;
+  }
+
+ private:
+  typedef std::pair<Vertex, Filtration_value> Neighbor;
+
+  Neighbor* find_neighbor(Vertex u, Vertex v) {
+    auto& ngb = neighbors_[u];
+    auto it = std::lower_bound(ngb.begin(), ngb.end(), v, [](const Neighbor& n, Vertex x) { return n.first < x; });
+    if (it == ngb.end() || it->first != v) return nullptr;
+    return &*it;
+  }
+
+  void remove_neighbor(Vertex u, Vertex v) {
+    auto& ngb = neighbors_[u];
+    ngb.erase(std::lower_bound(ngb.begin(), ngb.end(), v, [](const Neighbor& n, Vertex x) { return n.first < x; }));
+  }
+
+  static void insert_sorted(std::vector<Vertex>& vertices, Vertex v) {
+    vertices.insert(std::lower_bound(vertices.begin(), vertices.end(), v), v);
+  }
+
+  /* Returns a vertex of common, sorted, adjacent at the given time to all the others, or nullptr. */
+  const Vertex* find_dominator(const std::vector<Vertex>& common, Filtration_value time) const {
+    for (const Vertex& w : common) {
+      auto ngb_it = neighbors_[w].begin();
+      auto ngb_end = neighbors_[w].end();
+      bool dominates = true;
+      for (Vertex x : common) {
+        if (x == w) continue;
+        while (ngb_it != ngb_end && ngb_it->first < x) ++ngb_it;
+        if (ngb_it == ngb_end || ngb_it->first != x || time < ngb_it->second) {
+          dominates = false;
+          break;
+        }
+      }
+      if (dominates) return &w;
+    }
+    return nullptr;
+  }
+
+  // Sorted open neighborhood of each vertex, with the current filtration value of the edges.
+  std::vector<std::vector<Neighbor>> neighbors_;
+  // The input edges, without duplicates, sorted by filtration value.
+  std::vector<Filtered_edge> edges_;
+};
+
+/** \brief Implicitly constructs a flag complex from edges, collapses edges while preserving the persistent homology
+ * and returns the remaining edges.
+ *
+ * \ingroup edge_collapse
+ *
+ * \tparam FilteredEdgeRange Range of `std::tuple<Vertex, Vertex, Filtration_value>`, where `Vertex` is a
+ * non-negative integer type (vertices are used as indices, they should preferably be contiguous) and
+ * `Filtration_value` is totally ordered.
+ *
+ * @param[in] edges The edges of the filtered flag complex. Duplicated edges keep their smallest filtration value,
+ * loops are ignored. The vertices are assumed to appear before any edge, e.g. with filtration value 0 for a Rips
+ * complex.
+ * @return The remaining edges, sorted by filtration value, whose filtration value may have been increased. The flag
+ * complex they define, with the same vertices, has the same persistence diagram as the input one.
+ */
+template <class FilteredEdgeRange>
+auto flag_complex_collapse_edges(const FilteredEdgeRange& edges) {
+  using Filtered_edge = typename std::decay<typename boost::range_value<FilteredEdgeRange>::type>::type;
+  using Vertex = typename std::decay<typename std::tuple_element<0, Filtered_edge>::type>::type;
+  using Filtration_value = typename std::decay<typename std::tuple_element<2, Filtered_edge>::type>::type;
+  Flag_complex_edge_collapser<Vertex, Filtration_value> collapser(edges);
+  return collapser.collapse();
+}
+
+/** \brief Same as `flag_complex_collapse_edges`, on a graph as the one returned by `Gudhi::compute_proximity_graph`.
+ *
+ * \ingroup edge_collapse
+ *
+ * \tparam OneSkeletonGraph Model of <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/EdgeListGraph.html">
+ * boost::EdgeListGraph</a> with properties `Gudhi::vertex_filtration_t` and `Gudhi::edge_filtration_t`, as accepted
+ * by `Simplex_tree::insert_graph`, and constructible from a range of edges, a range of filtration values and a number
+ * of vertices, like a `boost::adjacency_list`.
+ *
+ * @param[in] skel_graph The 1-skeleton of the filtered flag complex.
+ * @return A graph with the same vertices and the remaining edges, to be given to `Simplex_tree::insert_graph`.
+ */
+template <class OneSkeletonGraph>
+OneSkeletonGraph flag_complex_collapse_edges_of_graph(const OneSkeletonGraph& skel_graph) {
+  using Vertex = typename boost::graph_traits<OneSkeletonGraph>::vertex_descriptor;
+  using Filtration_value = typename boost::property_traits<
+      typename boost::property_map<OneSkeletonGraph, edge_filtration_t>::const_type>::value_type;
+
+  std::vector<std::tuple<Vertex, Vertex, Filtration_value>> edges;
+  edges.reserve(boost::num_edges(skel_graph));
+  for (auto edge : boost::make_iterator_range(boost::edges(skel_graph)))
+    edges.emplace_back(boost::source(edge, skel_graph), boost::target(edge, skel_graph),
+                       boost::get(edge_filtration_t(), skel_graph, edge));
+
+  std::vector<std::pair<Vertex, Vertex>> remaining_edges;
+  std::vector<Filtration_value> remaining_edges_fil;
+  for (auto& edge : flag_complex_collapse_edges(edges)) {
+    remaining_edges.emplace_back(std::get<0>(edge), std::get<1>(edge));
+    remaining_edges_fil.push_back(std::get<2>(edge));
+  }
+  OneSkeletonGraph collapsed_graph(remaining_edges.begin(), remaining_edges.end(), remaining_edges_fil.begin(),
+                                   boost::num_vertices(skel_graph));
+  for (auto vertex : boost::make_iterator_range(boost::vertices(skel_graph)))
+    boost::put(vertex_filtration_t(), collapsed_graph, vertex, boost::get(vertex_filtration_t(), skel_graph, vertex));
+  return collapsed_graph;
+}
+
+}  // namespace collapse
+
+}  // namespace Gudhi
+
+#endif  // FLAG_COMPLEX_EDGE_COLLAPSER_H_
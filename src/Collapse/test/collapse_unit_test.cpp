@@ -0,0 +1,134 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "collapse"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Vertex_handle = Simplex_tree::Vertex_handle;
+using Filtered_edge = std::tuple<Vertex_handle, Vertex_handle, Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
+using Point = std::vector<double>;
+using Interval = std::pair<Filtration_value, Filtration_value>;
+
+std::vector<std::vector<Interval>> persistence_of_flag_complex(const std::vector<Filtered_edge>& edges,
+                                                               int num_vertices, int max_dim) {
+  Simplex_tree st;
+  for (int v = 0; v < num_vertices; ++v)
+    st.insert_simplex({v}, 0.);
+  for (auto& edge : edges)
+    st.insert_simplex({std::get<0>(edge), std::get<1>(edge)}, std::get<2>(edge));
+  st.expansion(max_dim);
+
+  Persistent_cohomology pcoh(st);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  std::vector<std::vector<Interval>> diagram;
+  for (int dim = 0; dim < max_dim; ++dim) {
+    std::vector<Interval> intervals;
+    for (auto& interval : pcoh.intervals_in_dimension(dim))
+      if (interval.first < interval.second) intervals.push_back(interval);
+    std::sort(intervals.begin(), intervals.end());
+    diagram.push_back(intervals);
+  }
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE(collapse_complete_graph) {
+  // All the edges of a clique but those of a spanning star are dominated
+  std::vector<Filtered_edge> edges;
+  for (Vertex_handle u = 0; u < 5; ++u)
+    for (Vertex_handle v = u + 1; v < 5; ++v)
+      edges.emplace_back(u, v, 1.);
+  auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  BOOST_CHECK(remaining_edges.size() == 4);
+  BOOST_CHECK(persistence_of_flag_complex(remaining_edges, 5, 3) == persistence_of_flag_complex(edges, 5, 3));
+}
+
+BOOST_AUTO_TEST_CASE(collapse_square) {
+  // A cycle of length 4 is not collapsible, and is filled by a diagonal
+  std::vector<Filtered_edge> edges{{0, 1, 1.}, {1, 2, 1.}, {2, 3, 1.}, {0, 3, 1.}, {0, 2, 2.}, {1, 3, 3.}};
+  auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  // The last diagonal is dominated forever, the first one kills the cycle
+  BOOST_CHECK(remaining_edges.size() == 5);
+  BOOST_CHECK(std::find(remaining_edges.begin(), remaining_edges.end(), Filtered_edge(0, 2, 2.)) !=
+              remaining_edges.end());
+  auto diagram = persistence_of_flag_complex(remaining_edges, 4, 3);
+  BOOST_CHECK(diagram == persistence_of_flag_complex(edges, 4, 3));
+  BOOST_CHECK(diagram[1] == std::vector<Interval>({{1., 2.}}));
+}
+
+BOOST_AUTO_TEST_CASE(collapse_delays_edges) {
+  // 01 is dominated by 2 until 3 becomes a common neighbor that 2 does not see, 13 is kept because of 4
+  std::vector<Filtered_edge> edges{{1, 4, .5}, {3, 4, .5}, {0, 2, 1.}, {1, 2, 1.},
+                                   {0, 1, 2.}, {0, 3, 3.}, {1, 3, 4.}};
+  auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  BOOST_CHECK(remaining_edges.size() == edges.size());
+  BOOST_CHECK(std::find(remaining_edges.begin(), remaining_edges.end(), Filtered_edge(0, 1, 4.)) !=
+              remaining_edges.end());
+  BOOST_CHECK(persistence_of_flag_complex(remaining_edges, 5, 3) == persistence_of_flag_complex(edges, 5, 3));
+}
+
+BOOST_AUTO_TEST_CASE(collapse_rips_graph) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points;
+  for (int i = 0; i < 60; ++i)
+    points.push_back({coord(gen), coord(gen), coord(gen)});
+
+  auto graph = Gudhi::compute_proximity_graph<Simplex_tree>(points, 0.6, Gudhi::Euclidean_distance());
+  auto collapsed_graph = Gudhi::collapse::flag_complex_collapse_edges_of_graph(graph);
+  std::cout << "collapse_rips_graph - " << boost::num_edges(graph) << " edges, " << boost::num_edges(collapsed_graph)
+            << " after collapse" << std::endl;
+  BOOST_CHECK(boost::num_vertices(collapsed_graph) == boost::num_vertices(graph));
+  BOOST_CHECK(boost::num_edges(collapsed_graph) < boost::num_edges(graph));
+
+  const int max_dim = 4;
+  Simplex_tree st;
+  st.insert_graph(graph);
+  st.expansion(max_dim);
+  Simplex_tree st_collapsed;
+  st_collapsed.insert_graph(collapsed_graph);
+  st_collapsed.expansion(max_dim);
+  BOOST_CHECK(st_collapsed.num_simplices() < st.num_simplices());
+
+  Persistent_cohomology pcoh(st);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Persistent_cohomology pcoh_collapsed(st_collapsed);
+  pcoh_collapsed.init_coefficients(2);
+  pcoh_collapsed.compute_persistent_cohomology();
+  // The expansion is truncated, only compare below the maximal dimension
+  for (int dim = 0; dim < max_dim; ++dim) {
+    std::vector<Interval> intervals, intervals_collapsed;
+    for (auto& interval : pcoh.intervals_in_dimension(dim))
+      if (interval.first < interval.second) intervals.push_back(interval);
+    for (auto& interval : pcoh_collapsed.intervals_in_dimension(dim))
+      if (interval.first < interval.second) intervals_collapsed.push_back(interval);
+    std::sort(intervals.begin(), intervals.end());
+    std::sort(intervals_collapsed.begin(), intervals_collapsed.end());
+    BOOST_CHECK(intervals == intervals_collapsed);
+  }
+}
@@ -0,0 +1,121 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Boundary_matrix_reduction.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/Clock.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>  // for std::sort, std::max
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <thread>  // for std::thread::hardware_concurrency
+
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Field_Z2 = Gudhi::persistent_cohomology::Field_Z2;
+using Reduction_algorithm = Gudhi::persistent_cohomology::Reduction_algorithm;
+using Point = std::vector<double>;
+using Points_off_reader = Gudhi::Points_off_reader<Point>;
+using Diagram = std::vector<std::tuple<int, Filtration_value, Filtration_value>>;
+
+template<class Persistence>
+Diagram sorted_diagram(Simplex_tree& st, const Persistence& pers) {
+  Diagram diagram;
+  for (auto pair : pers.get_persistent_pairs())
+    diagram.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                         st.filtration(std::get<1>(pair)));
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+template<class Persistence>
+void run(Persistence& pers, Simplex_tree& st, int p, const std::string& engine, const Diagram* reference) {
+  Gudhi::Clock clock;
+  pers.init_coefficients(p);
+  pers.compute_persistent_cohomology();
+  clock.end();
+  Diagram diagram = sorted_diagram(st, pers);
+  std::cout << engine << ", " << p << ", " << clock.num_seconds() << ", " << diagram.size();
+  if (reference != nullptr) std::cout << ", " << (diagram == *reference ? "same" : "DIFFERENT");
+  std::cout << std::endl;
+}
+
+/* Head-to-head timings of the compressed annotation matrix of Persistent_cohomology and of the reductions of
+ * Boundary_matrix_reduction, with coefficients in Z/pZ, on the Rips complex of a point cloud. Field_Z2 is used for
+ * p = 2. The diagrams of the reductions are compared with the one of Persistent_cohomology. With TBB, the chunk
+ * reduction is then timed with 1, 2, 4 and 8 threads, and up to the number of cores if there are more.
+ *
+ * Usage: boundary_matrix_reduction_benchmark [OFF file = Kl.off] [threshold = 0.27] [dimension = 3] [p = 2]
+ */
+template<class Field>
+void benchmark(Simplex_tree& st, int p) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field> pcoh(st);
+  run(pcoh, st, p, "compressed annotation matrix", nullptr);
+  Diagram reference = sorted_diagram(st, pcoh);
+
+  const std::pair<Reduction_algorithm, std::string> algorithms[] = {
+      {Reduction_algorithm::cohomology, "cohomology"},
+      {Reduction_algorithm::twist, "twist"},
+      {Reduction_algorithm::standard, "standard"},
+      {Reduction_algorithm::chunk, "chunk"}};
+  for (auto& algorithm : algorithms) {
+    Gudhi::persistent_cohomology::Boundary_matrix_reduction<Simplex_tree, Field> reduction(st, false, algorithm.first);
+    run(reduction, st, p, algorithm.second, &reference);
+  }
+
+#ifdef GUDHI_USE_TBB
+  // One chunk per thread, with more threads than cores on small machines
+  unsigned max_threads = std::max(8u, std::thread::hardware_concurrency());
+  std::vector<unsigned> thread_counts;
+  for (unsigned threads = 1; threads < max_threads; threads *= 2) thread_counts.push_back(threads);
+  thread_counts.push_back(max_threads);
+  for (unsigned threads : thread_counts) {
+    tbb::task_arena arena(threads);
+    arena.execute([&] {
+      Gudhi::persistent_cohomology::Boundary_matrix_reduction<Simplex_tree, Field> reduction(st, false,
+                                                                                         Reduction_algorithm::chunk);
+      run(reduction, st, p, "chunk, " + std::to_string(threads) + " threads", &reference);
+    });
+  }
+#endif
+}
+
+int main(int argc, char* argv[]) {
+  std::string off_file_points = argc > 1 ? argv[1] : "Kl.off";
+  Filtration_value threshold = argc > 2 ? std::stod(argv[2]) : 0.27;
+  int dim_max = argc > 3 ? std::stoi(argv[3]) : 3;
+  int p = argc > 4 ? std::stoi(argv[4]) : 2;
+
+  Points_off_reader off_reader(off_file_points);
+  Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+  Simplex_tree st;
+  rips_complex_from_file.create_complex(st, dim_max);
+  st.initialize_filtration();
+  std::cout << "The complex contains " << st.num_simplices() << " simplices" << std::endl;
+
+  std::cout << "engine, p, time (s), number of pairs, diagram" << std::endl;
+  if (p == 2)
+    benchmark<Field_Z2>(st, p);
+  else
+    benchmark<Field_Zp>(st, p);
+  return 0;
+}
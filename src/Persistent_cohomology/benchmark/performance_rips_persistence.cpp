@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <string>
+#include <type_traits>  // for std::is_same
 #include <vector>
 
 // Types definition
@@ -25,12 +26,14 @@ using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persis
 using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
 using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Field_Z2 = Gudhi::persistent_cohomology::Field_Z2;
 using Multi_field = Gudhi::persistent_cohomology::Multi_field;
 using Point = std::vector<double>;
 using Points_off_reader = Gudhi::Points_off_reader<Point>;
 
-/* Compute the persistent homology of the complex cpx with coefficients in Z/pZ. */
-template< typename FilteredComplex>
+/* Compute the persistent homology of the complex cpx with coefficients in Z/pZ, represented by Field, which may be
+ * Field_Z2 if p = 2. */
+template< typename FilteredComplex, typename Field = Field_Zp>
 void timing_persistence(FilteredComplex & cpx
                         , int p);
 
@@ -51,7 +54,8 @@ void timing_persistence(FilteredComplex & cpx
  * a faster computation of persistence because boundaries are precomputed. 
  * Hovewer, the simplex tree may be constructed directly from a point cloud and
  * is more compact.
- * We compute persistent homology with coefficient fields Z/2Z and Z/1223Z.
+ * We compute persistent homology with coefficient fields Z/2Z and Z/1223Z, and
+ * with the specialized representation of Z/2Z of Field_Z2.
  * We present also timings for the computation of multi-field persistent 
  * homology in all fields Z/rZ for r prime between 2 and 1223.
  */
@@ -118,11 +122,13 @@ int main(int argc, char * argv[]) {
 
   std::cout << "Timings when using a simplex tree: \n";
   timing_persistence(st, p);
+  timing_persistence<Simplex_tree, Field_Z2>(st, 2);
   timing_persistence(st, q);
   timing_persistence(st, p, q);
 
   std::cout << "Timings when using a Hasse complex: \n";
   timing_persistence(hcpx, p);
+  timing_persistence<Gudhi::Hasse_complex<>, Field_Z2>(hcpx, 2);
   timing_persistence(hcpx, q);
   timing_persistence(hcpx, p, q);
 
@@ -134,7 +140,7 @@ int main(int argc, char * argv[]) {
   return 0;
 }
 
-template< typename FilteredComplex>
+template< typename FilteredComplex, typename Field>
 void
 timing_persistence(FilteredComplex & cpx
                    , int p) {
@@ -142,7 +148,7 @@ timing_persistence(FilteredComplex & cpx
   int elapsed_sec;
   {
   start = std::chrono::system_clock::now();
-  Gudhi::persistent_cohomology::Persistent_cohomology< FilteredComplex, Field_Zp > pcoh(cpx);
+  Gudhi::persistent_cohomology::Persistent_cohomology< FilteredComplex, Field > pcoh(cpx);
   end = std::chrono::system_clock::now();
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   std::cout << "  Initialize pcoh in " << elapsed_sec << " ms.\n";
@@ -159,7 +165,8 @@ timing_persistence(FilteredComplex & cpx
 
   end = std::chrono::system_clock::now();
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-  std::cout << "  Compute persistent homology in Z/" << p << "Z in " << elapsed_sec << " ms.\n";
+  std::cout << "  Compute persistent homology in Z/" << p << "Z"
+      << (std::is_same<Field, Field_Z2>::value ? " with Field_Z2" : "") << " in " << elapsed_sec << " ms.\n";
   start = std::chrono::system_clock::now();
   }
   end = std::chrono::system_clock::now();
@@ -101,7 +101,18 @@ Filtration_simplex_range filtration_simplex_range();
   * This is never called on null_simplex(). */
   void                     assign_key(Simplex_handle sh, Simplex_key n);
 /** @} */
- 
+
+/** \name Stored boundaries (optional)
+  * If the complex provides both members, the persistence reads the keys of the facets from `boundary_keys` instead
+  * of calling `key` on the `boundary_simplex_range`, whenever `has_boundary_keys()` returns true.
+  *  @{ */
+/** \brief Returns whether `boundary_keys` can be called. */
+  bool                     has_boundary_keys() const;
+/** \brief Returns a range over the keys of the facets of the simplex of key `k`, in the order of
+  * `boundary_simplex_range`. The keys are those assigned by `assign_key` in the order of the filtration. */
+  unspecified              boundary_keys(Simplex_key k) const;
+/** @} */
+
 
 /* \brief Iterator over the simplices of the complex,
   * in an arbitrary order.
@@ -127,6 +127,34 @@ namespace persistent_cohomology {
  by increasing filtration values (breaking ties so as a simplex appears after
  its subsimplices of same filtration value) provides an indexing scheme.
 
+ \section pcohz2 Coefficients in Z/2Z
+ With `Gudhi::persistent_cohomology::Field_Z2` as coefficient field, `Persistent_cohomology` uses, at compile time,
+ a compressed annotation matrix without coefficients: a column is the sorted vector of the keys of its non-zero rows
+ and columns are added by symmetric difference. The diagrams are the ones computed with `Field_Zp` and
+ \f$p = 2\f$, with less memory per non-zero coefficient.
+
+ \section pcohfields Coefficient fields known at compile time
+ `Gudhi::persistent_cohomology::Field_Zp_static` is \f$\mathbb{Z}/p\mathbb{Z}\f$ for a prime \f$p\f$ given as template
+ parameter, e.g. `Field_Zp_static<3>`. The reductions modulo the constant \f$p\f$ are compiled without divisions and
+ the inverses of the small primes are a table computed at compile time, while `Field_Zp` reads \f$p\f$ at run time.
+
+ `Gudhi::persistent_cohomology::Multi_field_small` is `Multi_field` with 64-bit integers instead of GMP integers, so
+ that one machine multiplication covers all the fields. It accepts the sets of primes whose product is smaller than
+ \f$2^{62}\f$, e.g. all the primes up to 47, and does not require GMP.
+
+ \section pcohreduction Boundary matrix reduction
+ `Gudhi::persistent_cohomology::Boundary_matrix_reduction` computes the same persistence pairs, with the same
+ interface, by reduction of the boundary matrix of the complex, or of its coboundary matrix, with the clearing
+ optimization. The algorithm is chosen with `Gudhi::persistent_cohomology::Reduction_algorithm`, and the utility
+ `rips_persistence` selects it with its `--algorithm` option.
+
+ `Gudhi::persistent_cohomology::Reduction_algorithm::chunk` is the parallel one, when GUDHI is built with TBB: the
+ filtration is cut into one chunk of consecutive simplices per thread, and each chunk is reduced independently with
+ its own pivots \cite Bauer:arXiv1303.0477 . Most of the columns are paired this way, or at least compressed in
+ parallel, with the pairs found in the other chunks, and the few columns that remain are reduced sequentially. The
+ pairs do not depend on the number of threads, and the benchmark `boundary_matrix_reduction_benchmark` reports its
+ time for 1, 2, 4... threads.
+
 \section pcohexamples Examples
 
 We provide several example files: run these examples with -h for details on their use, and read the README file.
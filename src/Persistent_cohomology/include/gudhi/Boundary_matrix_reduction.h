@@ -0,0 +1,741 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef BOUNDARY_MATRIX_REDUCTION_H_
+#define BOUNDARY_MATRIX_REDUCTION_H_
+
+#include <gudhi/Persistent_cohomology.h>  // for Has_boundary_keys and the coefficient fields
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <vector>
+#include <tuple>
+#include <utility>  // for std::swap
+#include <algorithm>  // for std::sort, std::lower_bound
+#include <limits>  // for numeric_limits<>
+#include <fstream>  // std::ofstream
+#include <string>
+#include <stdexcept>  // for std::out_of_range
+#include <cstddef>  // for std::size_t
+#include <functional>  // for std::function
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Algorithms of `Boundary_matrix_reduction`.
+ *
+ * \ingroup persistent_cohomology
+ */
+enum class Reduction_algorithm {
+  /** \brief Column reduction of the boundary matrix in the order of the filtration, without clearing. */
+  standard,
+  /** \brief Column reduction of the boundary matrix by decreasing dimension, where the column of a simplex that is
+   * the pivot of a reduced column is cleared instead of being reduced. */
+  twist,
+  /** \brief Column reduction of the coboundary matrix by increasing dimension, with clearing, and a union-find for
+   * the dimension 0. */
+  cohomology,
+  /** \brief Reduction of the boundary matrix in chunks of consecutive simplices of the filtration
+   * \cite Bauer:arXiv1303.0477 . Each chunk is reduced with clearing, independently and in parallel with TBB, with
+   * the pivots of its own columns only. The remaining columns are then compressed with the pairs found in the chunks,
+   * and reduced sequentially. With TBB, the columns of these pairs are compressed one dimension per thread, and the
+   * remaining columns in parallel. */
+  chunk
+};
+
+/** \brief Computes the persistent homology of a filtered complex by reduction of its boundary matrix.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * This is an alternative to `Persistent_cohomology` with the same interface, except for the multi-field persistence:
+ * it is constructed from a model of `FilteredComplex`, and `get_persistent_pairs()` returns the same persistence
+ * pairs, which makes it easy to switch between the two. The boundary matrix, or the coboundary matrix with
+ * `Reduction_algorithm::cohomology`, is stored as sparse columns of the keys of the simplices and reduced
+ * \cite DBLP:books/daglib/0025666 with the clearing optimization \cite Chen11persistenthomology
+ * \cite Bauer:arXiv1303.0477 . The matrix is built when `compute_persistent_cohomology()` is called, and released
+ * once the pairs are computed.
+ *
+ * On Rips complexes, the cohomology reduction is the fastest one: most of its columns are already reduced and are
+ * never copied, and its time is dominated by the construction of the matrix. The reductions of the boundary matrix
+ * suffer from the fill-in of the columns of the higher dimensional simplices of flag complexes. The chunk reduction
+ * does the same work as the twist reduction on a single thread, but most of it is spread over the threads.
+ *
+ * \tparam FilteredComplex is a model of `FilteredComplex`.
+ * \tparam CoefficientField is a model of `CoefficientField` with a single characteristic, i.e. `Field_Z2` or
+ * `Field_Zp`.
+ *
+ * \implements PersistentHomology
+ */
+template<class FilteredComplex, class CoefficientField = Field_Z2>
+class Boundary_matrix_reduction {
+ public:
+  /** \brief Data stored for each simplex. */
+  typedef typename FilteredComplex::Simplex_key Simplex_key;
+  /** \brief Handle to specify a simplex. */
+  typedef typename FilteredComplex::Simplex_handle Simplex_handle;
+  /** \brief Type for the value of the filtration function. */
+  typedef typename FilteredComplex::Filtration_value Filtration_value;
+  /** \brief Type of element of the field. */
+  typedef typename CoefficientField::Element Arith_element;
+  /** \brief Type for birth and death FilteredComplex::Simplex_handle.
+   * The Arith_element field is the characteristic of the field. */
+  typedef std::tuple<Simplex_handle, Simplex_handle, Arith_element> Persistent_interval;
+
+ private:
+  // A non-zero coefficient of a column.
+  struct Entry {
+    Simplex_key key;
+    Arith_element coefficient;
+  };
+  // Sorted so that the pivot is the last entry: by increasing keys for the boundary matrix, by decreasing keys for
+  // the coboundary matrix.
+  typedef std::vector<Entry> Column;
+
+  struct Increasing_keys {
+    bool operator()(Simplex_key a, Simplex_key b) const { return a < b; }
+  };
+  struct Decreasing_keys {
+    bool operator()(Simplex_key a, Simplex_key b) const { return b < a; }
+  };
+
+ public:
+  /** \brief Initializes the Boundary_matrix_reduction class, and assigns the keys of the simplices in the order of
+   * the filtration.
+   *
+   * @param[in] cpx Complex for which the persistent homology is computed.
+   * cpx is a model of FilteredComplex
+   * @param[in] persistence_dim_max if true, the persistent homology for the maximal dimension in the
+   *                                complex is computed. If false, it is ignored. Default is false.
+   * @param[in] algorithm The reduction algorithm. Default is `Reduction_algorithm::cohomology`.
+   *
+   * @exception std::out_of_range In case the number of simplices is more than Simplex_key type numeric limit.
+   */
+  explicit Boundary_matrix_reduction(FilteredComplex& cpx, bool persistence_dim_max = false,
+                                     Reduction_algorithm algorithm = Reduction_algorithm::cohomology)
+      : cpx_(&cpx),
+        dim_max_(cpx.dimension()),
+        coeff_field_(),
+        num_simplices_(cpx.num_simplices()),
+        algorithm_(algorithm) {
+    if (num_simplices_ > std::numeric_limits<Simplex_key>::max()) {
+      // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
+      throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
+    }
+    Simplex_key idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      cpx_->assign_key(sh, idx_fil);
+      ++idx_fil;
+    }
+    if (persistence_dim_max) {
+      ++dim_max_;
+    }
+  }
+
+  /** \brief Initializes the coefficient field.*/
+  void init_coefficients(int charac) {
+    coeff_field_.init(charac);
+  }
+
+  /** \brief Returns the reduction algorithm. */
+  Reduction_algorithm algorithm() const {
+    return algorithm_;
+  }
+
+  /** \brief Sets the number of chunks of `Reduction_algorithm::chunk`. The default, 0, is one chunk per thread of
+   * the current TBB task arena, or a single chunk without TBB. The pairs do not depend on it. */
+  void set_num_chunks(std::size_t num_chunks) {
+    num_chunks_ = num_chunks;
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * Assumes that the filtration provided by the simplicial complex is
+   * valid. Undefined behavior otherwise. */
+  void compute_persistent_cohomology(Filtration_value min_interval_length = 0) {
+    min_interval_length_ = min_interval_length;
+    persistent_pairs_.clear();
+    build_boundary_matrix();
+    paired_.assign(num_simplices_, false);
+    pivot_owner_.assign(num_simplices_, null_key());
+    columns_.resize(num_simplices_);
+    switch (algorithm_) {
+      case Reduction_algorithm::standard:
+        reduce_standard();
+        break;
+      case Reduction_algorithm::twist:
+        reduce_twist();
+        break;
+      case Reduction_algorithm::cohomology:
+        reduce_cohomology();
+        break;
+      case Reduction_algorithm::chunk:
+        reduce_chunks();
+        break;
+    }
+    // The simplices that are neither a birth nor a death create the infinite intervals
+    for (int dim = 0; dim < dim_max_ && dim < static_cast<int>(keys_by_dim_.size()); ++dim) {
+      for (Simplex_key key : keys_by_dim_[dim]) {
+        if (!paired_[key])
+          store_pair(cpx_->simplex(key), cpx_->null_simplex());
+      }
+    }
+    release_matrix();
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex, and pass each persistent interval to pair_sink as soon as it is found, instead of storing it.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   * @param[in] pair_sink callable with a `const Persistent_interval&`. It receives the finite intervals in the order
+   *                      of the reduction, then the infinite intervals.
+   * @param[in] dimension if non negative, pair_sink only receives the intervals of this dimension, i.e. the ones
+   *                      whose birth simplex has this dimension.
+   *
+   * As with `Persistent_cohomology`, the intervals are not kept. Use `output_interval()` in pair_sink to write the
+   * diagram incrementally. */
+  template <class PairSink>
+  void compute_persistent_cohomology(Filtration_value min_interval_length, PairSink pair_sink, int dimension = -1) {
+    Pair_sink_reset reset{pair_sink_};
+    pair_sink_ = std::move(pair_sink);
+    pair_sink_dimension_ = dimension;
+    compute_persistent_cohomology(min_interval_length);
+  }
+
+ private:
+  static Simplex_key null_key() {
+    return std::numeric_limits<Simplex_key>::max();
+  }
+
+  /* Stores the keys of the facets of each simplex, and the keys of the simplices of each dimension. */
+  void build_boundary_matrix() {
+    keys_by_dim_.assign(std::max(cpx_->dimension(), 0) + 1, std::vector<Simplex_key>());
+    boundary_begin_.assign(1, 0);
+    boundary_begin_.reserve(num_simplices_ + 1);
+    boundary_.clear();
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      Simplex_key key = cpx_->key(sh);
+      keys_by_dim_[cpx_->dimension(sh)].push_back(key);
+      // Vertices have no boundary
+      if (cpx_->dimension(sh) > 0) {
+        for_each_boundary_key(sh, [&](Simplex_key facet) { boundary_.push_back(facet); },
+                              Has_boundary_keys<FilteredComplex>());
+      }
+      boundary_begin_.push_back(boundary_.size());
+    }
+  }
+
+  template <class F>
+  void for_each_boundary_key(Simplex_handle sigma, F&& f, std::true_type) {
+    if (cpx_->has_boundary_keys()) {
+      for (Simplex_key key : cpx_->boundary_keys(cpx_->key(sigma)))
+        f(key);
+    } else {
+      for_each_boundary_key(sigma, f, std::false_type());
+    }
+  }
+
+  template <class F>
+  void for_each_boundary_key(Simplex_handle sigma, F&& f, std::false_type) {
+    for (auto sh : cpx_->boundary_simplex_range(sigma))
+      f(cpx_->key(sh));
+  }
+
+  void release_matrix() {
+    std::vector<std::size_t>().swap(boundary_begin_);
+    std::vector<Simplex_key>().swap(boundary_);
+    std::vector<std::size_t>().swap(coboundary_begin_);
+    std::vector<Entry>().swap(coboundary_);
+    std::vector<std::vector<Simplex_key>>().swap(keys_by_dim_);
+    std::vector<bool>().swap(paired_);
+    std::vector<Simplex_key>().swap(pivot_owner_);
+    std::vector<Column>().swap(columns_);
+    Column().swap(column_buffer_);
+  }
+
+  /* Coefficient of the i-th facet in the boundary, in the alternate sum. */
+  Arith_element boundary_coefficient(std::size_t i) {
+    return coeff_field_.plus_times_equal(coeff_field_.additive_identity(), coeff_field_.multiplicative_identity(),
+                                         (i % 2 == 0) ? 1 : -1);
+  }
+
+  /* Sets column to the boundary of the simplex of key, sorted by increasing keys. */
+  void load_boundary(Simplex_key key, Column& column) {
+    column.clear();
+    for (std::size_t idx = boundary_begin_[key]; idx < boundary_begin_[key + 1]; ++idx)
+      column.push_back(Entry{boundary_[idx], boundary_coefficient(idx - boundary_begin_[key])});
+    std::sort(column.begin(), column.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+  }
+
+  /* Adds factor * [source, source_end) to target, both sorted in the order of Compare. */
+  template <class Compare>
+  void add_column(Column& target, const Entry* source, const Entry* source_end, Arith_element factor, Compare cmp) {
+    add_column(target, source, source_end, factor, cmp, column_buffer_);
+  }
+
+  /* Same, with the given buffer, for the concurrent reductions. */
+  template <class Compare>
+  void add_column(Column& target, const Entry* source, const Entry* source_end, Arith_element factor, Compare cmp,
+                  Column& buffer) {
+    buffer.clear();
+    auto t_it = target.begin();
+    while (t_it != target.end() && source != source_end) {
+      if (cmp(t_it->key, source->key)) {
+        buffer.push_back(*t_it++);
+      } else if (cmp(source->key, t_it->key)) {
+        buffer.push_back(Entry{source->key, coeff_field_.times(source->coefficient, factor)});
+        ++source;
+      } else {
+        Arith_element coefficient = coeff_field_.plus_times_equal(t_it->coefficient, source->coefficient, factor);
+        if (coefficient != coeff_field_.additive_identity())
+          buffer.push_back(Entry{t_it->key, coefficient});
+        ++t_it;
+        ++source;
+      }
+    }
+    buffer.insert(buffer.end(), t_it, target.end());
+    for (; source != source_end; ++source)
+      buffer.push_back(Entry{source->key, coeff_field_.times(source->coefficient, factor)});
+    target.swap(buffer);
+  }
+
+  /* Adds to column the multiple of the reduced column of owner that cancels the entry at position pos. */
+  void cancel_entry(Column& column, std::size_t pos, Simplex_key owner, Column& buffer) {
+    const Column& source = columns_[owner];
+    Arith_element inverse = coeff_field_.inverse(source.back().coefficient, coeff_field_.characteristic()).first;
+    add_column(column, source.data(), source.data() + source.size(),
+               coeff_field_.times_minus(column[pos].coefficient, inverse), Increasing_keys(), buffer);
+  }
+
+  /* Reduces the column of key until it is zero or its pivot is not the pivot of a reduced column. If it is not zero,
+   * pairs key with its pivot and returns it, and stores the column if it was modified. Otherwise, returns null_key().
+   * An unmodified column is not stored, its entries are read from the coboundary matrix, which is only possible with
+   * the cohomology. */
+  template <class Compare>
+  Simplex_key reduce_column(Simplex_key key, Column& column, Compare cmp) {
+    bool modified = false;
+    while (!column.empty()) {
+      Simplex_key owner = pivot_owner_[column.back().key];
+      if (owner == null_key()) break;
+      const Entry* source = columns_[owner].data();
+      const Entry* source_end = source + columns_[owner].size();
+      if (source == source_end) {
+        source = coboundary_.data() + coboundary_begin_[owner];
+        source_end = coboundary_.data() + coboundary_begin_[owner + 1];
+      }
+      Arith_element inverse = coeff_field_.inverse((source_end - 1)->coefficient, coeff_field_.characteristic()).first;
+      add_column(column, source, source_end, coeff_field_.times_minus(column.back().coefficient, inverse), cmp);
+      modified = true;
+    }
+    if (column.empty()) return null_key();
+    Simplex_key pivot = column.back().key;
+    set_pivot(key, pivot);
+    if (modified || algorithm_ != Reduction_algorithm::cohomology) columns_[key].swap(column);
+    return pivot;
+  }
+
+  void set_pivot(Simplex_key key, Simplex_key pivot) {
+    pivot_owner_[pivot] = key;
+    paired_[pivot] = true;
+    paired_[key] = true;
+  }
+
+  /* Adds the persistence pair, if it is long enough. */
+  void add_pair(Simplex_key birth, Simplex_key death) {
+    Simplex_handle birth_sh = cpx_->simplex(birth);
+    Simplex_handle death_sh = cpx_->simplex(death);
+    if (cpx_->filtration(death_sh) - cpx_->filtration(birth_sh) > min_interval_length_)
+      store_pair(birth_sh, death_sh);
+  }
+
+  /* Clears pair_sink_ when compute_persistent_cohomology returns, or when the sink throws. */
+  struct Pair_sink_reset {
+    std::function<void(const Persistent_interval&)>& pair_sink;
+    ~Pair_sink_reset() { pair_sink = nullptr; }
+  };
+
+  /* Stores the persistent interval, or passes it to the sink of compute_persistent_cohomology if any. */
+  void store_pair(Simplex_handle birth, Simplex_handle death) {
+    if (!pair_sink_)
+      persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+    else if (pair_sink_dimension_ < 0 || static_cast<int>(cpx_->dimension(birth)) == pair_sink_dimension_)
+      pair_sink_(Persistent_interval(birth, death, coeff_field_.characteristic()));
+  }
+
+  void reduce_standard() {
+    Column column;
+    for (Simplex_key key = 0; key < num_simplices_; ++key) {
+      load_boundary(key, column);
+      Simplex_key pivot = reduce_column(key, column, Increasing_keys());
+      if (pivot != null_key()) add_pair(pivot, key);
+    }
+  }
+
+  void reduce_twist() {
+    Column column;
+    for (int dim = static_cast<int>(keys_by_dim_.size()) - 1; dim > 0; --dim) {
+      for (Simplex_key key : keys_by_dim_[dim]) {
+        // Clearing: the simplex is a birth, its reduced column is zero
+        if (paired_[key]) continue;
+        load_boundary(key, column);
+        Simplex_key pivot = reduce_column(key, column, Increasing_keys());
+        if (pivot != null_key()) add_pair(pivot, key);
+      }
+      // The pivots of the lower dimension are in other columns
+      for (Simplex_key key : keys_by_dim_[dim]) Column().swap(columns_[key]);
+    }
+  }
+
+  void reduce_cohomology() {
+    if (keys_by_dim_.size() > 1) reduce_vertices();
+    build_coboundary_matrix();
+    Column column;
+    for (std::size_t dim = 1; dim + 1 < keys_by_dim_.size(); ++dim) {
+      const std::vector<Simplex_key>& keys = keys_by_dim_[dim];
+      for (auto key_it = keys.rbegin(); key_it != keys.rend(); ++key_it) {
+        // Clearing: the simplex is a death of the lower dimension, its reduced column is zero
+        if (paired_[*key_it]) continue;
+        const Entry* begin = coboundary_.data() + coboundary_begin_[*key_it];
+        const Entry* end = coboundary_.data() + coboundary_begin_[*key_it + 1];
+        if (begin == end) continue;
+        Simplex_key pivot = (end - 1)->key;
+        if (pivot_owner_[pivot] == null_key()) {
+          // The column is already reduced, it is not copied
+          set_pivot(*key_it, pivot);
+        } else {
+          column.assign(begin, end);
+          pivot = reduce_column(*key_it, column, Decreasing_keys());
+        }
+        if (pivot != null_key()) add_pair(*key_it, pivot);
+      }
+      for (Simplex_key key : keys) Column().swap(columns_[key]);
+    }
+  }
+
+  void reduce_chunks() {
+    std::size_t num_chunks = num_chunks_;
+    if (num_chunks == 0) {
+#ifdef GUDHI_USE_TBB
+      num_chunks = tbb::this_task_arena::max_concurrency();
+#else
+      num_chunks = 1;
+#endif
+    }
+    num_chunks = std::max<std::size_t>(1, std::min(num_chunks, num_simplices_));
+    auto chunk_begin = [&](std::size_t chunk) { return static_cast<Simplex_key>(num_simplices_ * chunk / num_chunks); };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_chunks, [&](std::size_t chunk) {
+      reduce_chunk(chunk_begin(chunk), chunk_begin(chunk + 1));
+    });
+#else
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) reduce_chunk(chunk_begin(chunk), chunk_begin(chunk + 1));
+#endif
+
+    // The columns with a pivot in their chunk are paired, the other non-zero columns are global.
+    std::vector<std::vector<Simplex_key>> global_keys(keys_by_dim_.size());
+    bool has_global_keys = false;
+    for (std::size_t dim = 1; dim < keys_by_dim_.size(); ++dim) {
+      for (Simplex_key key : keys_by_dim_[dim]) {
+        if (columns_[key].empty()) continue;
+        Simplex_key pivot = columns_[key].back().key;
+        if (pivot_owner_[pivot] == key) {
+          paired_[pivot] = true;
+          paired_[key] = true;
+          add_pair(pivot, key);
+        } else {
+          global_keys[dim].push_back(key);
+          has_global_keys = true;
+        }
+      }
+    }
+
+    // The columns of the pairs are compressed once, by increasing pivot, so that each one only adds compressed columns.
+    // These columns only add columns of the pivots of their dimension, so the dimensions are compressed in parallel.
+    if (has_global_keys) {
+      auto compress_pairs = [&](std::size_t dim, Column& buffer) {
+        for (Simplex_key pivot : keys_by_dim_[dim]) {
+          Simplex_key owner = pivot_owner_[pivot];
+          if (owner != null_key()) compress_column(columns_[owner], true, buffer);
+        }
+      };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), keys_by_dim_.size() - 1, [&](std::size_t dim) {
+        Column buffer;
+        compress_pairs(dim, buffer);
+      });
+#else
+      for (std::size_t dim = 0; dim + 1 < keys_by_dim_.size(); ++dim) compress_pairs(dim, column_buffer_);
+#endif
+    }
+
+    for (auto& keys : global_keys) {
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, keys.size()),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+        Column buffer;
+        for (std::size_t idx = range.begin(); idx != range.end(); ++idx)
+          compress_column(columns_[keys[idx]], false, buffer);
+      });
+#else
+      for (Simplex_key key : keys) compress_column(columns_[key], false, column_buffer_);
+#endif
+    }
+
+    // The twist reduction of the compressed global columns
+    Column column;
+    for (std::size_t dim = global_keys.size(); dim-- > 1;) {
+      for (Simplex_key key : global_keys[dim]) {
+        column.swap(columns_[key]);
+        Column().swap(columns_[key]);
+        // Clearing: the simplex is a birth, its reduced column is zero
+        if (paired_[key]) continue;
+        Simplex_key pivot = reduce_column(key, column, Increasing_keys());
+        if (pivot != null_key()) add_pair(pivot, key);
+      }
+    }
+  }
+
+  /* Reduces the columns of the simplices of keys in [begin, end) with clearing, by decreasing dimension, as long as
+   * their pivot is in the chunk. Only the columns and the pivots of the chunk are written. */
+  void reduce_chunk(Simplex_key begin, Simplex_key end) {
+    Column column, buffer;
+    for (int dim = static_cast<int>(keys_by_dim_.size()) - 1; dim > 0; --dim) {
+      const std::vector<Simplex_key>& keys = keys_by_dim_[dim];
+      auto key_end = std::lower_bound(keys.begin(), keys.end(), end);
+      for (auto key_it = std::lower_bound(keys.begin(), keys.end(), begin); key_it != key_end; ++key_it) {
+        // Clearing: the simplex is the pivot of a column of the chunk
+        if (pivot_owner_[*key_it] != null_key()) continue;
+        load_boundary(*key_it, column);
+        while (!column.empty() && column.back().key >= begin) {
+          Simplex_key owner = pivot_owner_[column.back().key];
+          if (owner == null_key()) {
+            pivot_owner_[column.back().key] = *key_it;
+            break;
+          }
+          cancel_entry(column, column.size() - 1, owner, buffer);
+        }
+        columns_[*key_it].swap(column);
+      }
+    }
+  }
+
+  /* Removes from a column the rows of the pairs found in the chunks, except its pivot when it is the column of one of
+   * these pairs: a birth is cancelled by the column of its death, and a death can never be a pivot. The columns of the
+   * deaths are compressed, so that they have no such row to cancel in turn: the multiples of all of them are summed
+   * with the column in one pass, and the death rows are dropped on the way. Only this column is written. */
+  void compress_column(Column& column, bool keep_pivot, Column& buffer) {
+    auto rows_end = keep_pivot ? column.end() - 1 : column.end();
+    buffer.clear();
+    for (auto entry = column.begin(); entry != rows_end; ++entry) {
+      Simplex_key owner = pivot_owner_[entry->key];
+      if (owner == null_key()) {
+        if (!paired_[entry->key]) buffer.push_back(*entry);
+        continue;
+      }
+      // The multiple of the column of owner that cancels the row, its pivot, which is not copied
+      const Column& source = columns_[owner];
+      Arith_element inverse = coeff_field_.inverse(source.back().coefficient, coeff_field_.characteristic()).first;
+      Arith_element factor = coeff_field_.times_minus(entry->coefficient, inverse);
+      for (auto source_it = source.begin(); source_it + 1 != source.end(); ++source_it)
+        buffer.push_back(Entry{source_it->key, coeff_field_.times(source_it->coefficient, factor)});
+    }
+    std::sort(buffer.begin(), buffer.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+    Entry pivot = keep_pivot ? column.back() : Entry();
+    column.clear();
+    for (auto entry = buffer.begin(); entry != buffer.end();) {
+      Entry sum = *entry;
+      for (++entry; entry != buffer.end() && entry->key == sum.key; ++entry)
+        sum.coefficient = coeff_field_.plus_equal(sum.coefficient, entry->coefficient);
+      if (sum.coefficient != coeff_field_.additive_identity()) column.push_back(sum);
+    }
+    if (keep_pivot) column.push_back(pivot);
+  }
+
+  /* Pairs the vertices and the edges with a union-find, by the elder rule. */
+  void reduce_vertices() {
+    // Root of the component of a vertex, of the oldest vertex for the roots
+    std::vector<Simplex_key> parent(num_simplices_, null_key());
+    for (Simplex_key vertex : keys_by_dim_[0]) parent[vertex] = vertex;
+    auto find = [&](Simplex_key key) {
+      while (parent[key] != key) {
+        parent[key] = parent[parent[key]];
+        key = parent[key];
+      }
+      return key;
+    };
+    for (Simplex_key edge : keys_by_dim_[1]) {
+      Simplex_key u = find(boundary_[boundary_begin_[edge]]);
+      Simplex_key v = find(boundary_[boundary_begin_[edge] + 1]);
+      if (u == v) continue;
+      if (u < v) std::swap(u, v);
+      // The component of the younger vertex u dies
+      parent[u] = v;
+      paired_[u] = true;
+      paired_[edge] = true;
+      add_pair(u, edge);
+    }
+  }
+
+  /* Stores the cofacets of the simplices of dimension at least 1, sorted by decreasing keys, with the coefficients of
+   * the boundary matrix. */
+  void build_coboundary_matrix() {
+    coboundary_begin_.assign(num_simplices_ + 1, 0);
+    for (std::size_t dim = 2; dim < keys_by_dim_.size(); ++dim)
+      for (Simplex_key key : keys_by_dim_[dim])
+        for (std::size_t idx = boundary_begin_[key]; idx < boundary_begin_[key + 1]; ++idx)
+          ++coboundary_begin_[boundary_[idx] + 1];
+    for (std::size_t key = 0; key < num_simplices_; ++key)
+      coboundary_begin_[key + 1] += coboundary_begin_[key];
+    coboundary_.resize(coboundary_begin_[num_simplices_]);
+    // Filled from the last simplex of each dimension, so that the cofacets are sorted by decreasing keys
+    std::vector<std::size_t> next(coboundary_begin_.begin(), coboundary_begin_.end() - 1);
+    for (std::size_t dim = 2; dim < keys_by_dim_.size(); ++dim) {
+      for (auto key_it = keys_by_dim_[dim].rbegin(); key_it != keys_by_dim_[dim].rend(); ++key_it) {
+        for (std::size_t idx = boundary_begin_[*key_it]; idx < boundary_begin_[*key_it + 1]; ++idx)
+          coboundary_[next[boundary_[idx]]++] = Entry{*key_it, boundary_coefficient(idx - boundary_begin_[*key_it])};
+      }
+    }
+    // The boundaries are not needed anymore
+    std::vector<std::size_t>().swap(boundary_begin_);
+    std::vector<Simplex_key>().swap(boundary_);
+  }
+
+  /*
+   * Compare two intervals by length.
+   */
+  struct cmp_intervals_by_length {
+    explicit cmp_intervals_by_length(FilteredComplex * sc)
+        : sc_(sc) {
+    }
+    bool operator()(const Persistent_interval & p1, const Persistent_interval & p2) {
+      return (sc_->filtration(std::get<1>(p1)) - sc_->filtration(std::get<0>(p1))
+          > sc_->filtration(std::get<1>(p2)) - sc_->filtration(std::get<0>(p2)));
+    }
+    FilteredComplex * sc_;
+  };
+
+ public:
+  /** \brief Output the persistence diagram in ostream, in the format of `Persistent_cohomology::output_diagram`. */
+  void output_diagram(std::ostream& ostream = std::cout) {
+    cmp_intervals_by_length cmp(cpx_);
+    std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
+    for (auto pair : persistent_pairs_) {
+      output_interval(ostream, pair);
+    }
+  }
+
+  /** \brief Output a persistent interval in ostream, in the format of `Persistent_cohomology::output_interval`. */
+  void output_interval(std::ostream& ostream, const Persistent_interval& pair) const {
+    // Special case on windows, inf is "1.#INF" (cf. unitary tests and R package TDA)
+    if (std::numeric_limits<Filtration_value>::has_infinity &&
+        cpx_->filtration(std::get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
+      ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+        << cpx_->filtration(std::get<0>(pair)) << " inf \n";
+    } else {
+      ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+        << cpx_->filtration(std::get<0>(pair)) << " "
+        << cpx_->filtration(std::get<1>(pair)) << " \n";
+    }
+  }
+
+  /** @brief Returns Betti numbers.
+   * @return A vector of Betti numbers.
+   */
+  std::vector<int> betti_numbers() const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->null_simplex() == std::get<1>(pair))
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns the persistent Betti numbers.
+   * @param[in] from The persistence birth limit to be added in the number \f$(persistent birth \leq from)\f$.
+   * @param[in] to The persistence death limit to be added in the number  \f$(persistent death > to)\f$.
+   * @return A vector of persistent Betti numbers.
+   */
+  std::vector<int> persistent_betti_numbers(Filtration_value from, Filtration_value to) const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->filtration(std::get<0>(pair)) <= from &&
+          (std::get<1>(pair) == cpx_->null_simplex() || cpx_->filtration(std::get<1>(pair)) > to))
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns a list of persistence birth and death FilteredComplex::Simplex_handle pairs.
+   * @return A list of Boundary_matrix_reduction::Persistent_interval
+   */
+  const std::vector<Persistent_interval>& get_persistent_pairs() const {
+    return persistent_pairs_;
+  }
+
+  /** @brief Returns persistence intervals for a given dimension.
+   * @param[in] dimension Dimension to get the birth and death pairs from.
+   * @return A vector of persistence intervals (birth and death) on a fixed dimension.
+   */
+  std::vector< std::pair< Filtration_value , Filtration_value > >
+  intervals_in_dimension(int dimension) {
+    std::vector< std::pair< Filtration_value , Filtration_value > > result;
+    for (auto && pair : persistent_pairs_) {
+      if (cpx_->dimension(std::get<0>(pair)) == dimension)
+        result.emplace_back(cpx_->filtration(std::get<0>(pair)), cpx_->filtration(std::get<1>(pair)));
+    }
+    return result;
+  }
+
+ private:
+  FilteredComplex * cpx_;
+  int dim_max_;
+  CoefficientField coeff_field_;
+  std::size_t num_simplices_;
+  Reduction_algorithm algorithm_;
+  std::size_t num_chunks_ = 0;
+  Filtration_value min_interval_length_ = 0;
+  std::vector<Persistent_interval> persistent_pairs_;
+  /* Receives the persistent intervals instead of persistent_pairs_, during compute_persistent_cohomology. */
+  std::function<void(const Persistent_interval&)> pair_sink_;
+  /* The dimension of the intervals passed to pair_sink_, all of them if negative. */
+  int pair_sink_dimension_ = -1;
+
+  /* The matrix, only during compute_persistent_cohomology.
+   * The keys of the facets of the simplex of key k are boundary_[boundary_begin_[k]] to
+   * boundary_[boundary_begin_[k + 1] - 1], in the order of boundary_simplex_range. The cofacets are stored the same
+   * way in coboundary_ for the cohomology. */
+  std::vector<std::size_t> boundary_begin_;
+  std::vector<Simplex_key> boundary_;
+  std::vector<std::size_t> coboundary_begin_;
+  std::vector<Entry> coboundary_;
+  std::vector<std::vector<Simplex_key>> keys_by_dim_;
+  /* Whether a simplex is a birth or a death. */
+  std::vector<bool> paired_;
+  /* Key -> key of the reduced column whose pivot it is, or null_key(). */
+  std::vector<Simplex_key> pivot_owner_;
+  /* Key -> reduced column, for the columns that own a pivot in the dimension being reduced. */
+  std::vector<Column> columns_;
+  Column column_buffer_;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // BOUNDARY_MATRIX_REDUCTION_H_
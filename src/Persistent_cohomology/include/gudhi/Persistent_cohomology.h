@@ -13,6 +13,8 @@
 
 #include <gudhi/Persistent_cohomology/Persistent_cohomology_column.h>
 #include <gudhi/Persistent_cohomology/Field_Zp.h>
+#include <gudhi/Persistent_cohomology/Field_Z2.h>
+#include <gudhi/Persistent_cohomology/Field_Zp_static.h>
 #include <gudhi/Simple_object_pool.h>
 
 #include <boost/intrusive/set.hpp>
@@ -20,7 +22,9 @@
 #include <boost/intrusive/list.hpp>
 
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <iterator>  // for std::make_move_iterator
 #include <list>
 #include <vector>
 #include <set>
@@ -30,11 +34,23 @@
 #include <algorithm>
 #include <string>
 #include <stdexcept>  // for std::out_of_range
+#include <type_traits>  // for std::true_type
+#include <cstdint>  // for std::uint32_t
+#include <functional>  // for std::hash, std::function
 
 namespace Gudhi {
 
 namespace persistent_cohomology {
 
+/* Whether FilteredComplex can store the keys of the boundaries, see FilteredComplex::boundary_keys. */
+template <class FilteredComplex, class = void>
+struct Has_boundary_keys : std::false_type {};
+
+template <class FilteredComplex>
+struct Has_boundary_keys<FilteredComplex, decltype(void(std::declval<const FilteredComplex&>().boundary_keys(
+                                              std::declval<typename FilteredComplex::Simplex_key>())))>
+    : std::true_type {};
+
 /** \brief Computes the persistent cohomology of a filtered complex.
  *
  * \ingroup persistent_cohomology
@@ -81,6 +97,21 @@ class Persistent_cohomology {
   // Sparse column type for the annotation of the boundary of an element.
   typedef std::vector<std::pair<Simplex_key, Arith_element> > A_ds_type;
 
+  // Compressed Annotation Matrix with coefficients in Z/2Z, used instead of the one above with Field_Z2.
+  typedef std::integral_constant<bool, std::is_same<CoefficientField, Field_Z2>::value> Is_z2;
+  typedef Persistent_cohomology_z2_column<Simplex_key> Z2_column;
+  // A column of z2_columns_, with the serial number it had when it got a non-zero in the row.
+  struct Z2_column_ref {
+    std::uint32_t index;
+    std::uint32_t serial;
+  };
+  // The columns that had a non-zero in the row. Some of them may have been modified or destroyed since, they are
+  // removed when the size of the row doubles.
+  struct Z2_row {
+    std::vector<Z2_column_ref> columns;
+    std::size_t compacted_size = 0;
+  };
+
  public:
   /** \brief Initializes the Persistent_cohomology class.
    *
@@ -99,7 +130,7 @@ class Persistent_cohomology {
         num_simplices_(cpx_->num_simplices()),           // num_simplices save to avoid to call thrice the function
         ds_rank_(num_simplices_),                        // union-find
         ds_parent_(num_simplices_),                      // union-find
-        ds_repr_(num_simplices_, NULL),                  // union-find -> annotation vectors
+        ds_repr_(Is_z2::value ? 0 : num_simplices_, NULL),  // union-find -> annotation vectors
         dsets_(&ds_rank_[0], &ds_parent_[0]),            // union-find
         cam_(),                                          // collection of annotation vectors
         zero_cocycles_(),                                // union-find -> Simplex_key of creator for 0-homology
@@ -107,7 +138,8 @@ class Persistent_cohomology {
         persistent_pairs_(),
         interval_length_policy(&cpx, 0),
         column_pool_(),  // memory pools for the CAM
-        cell_pool_() {
+        cell_pool_(),
+        z2_repr_(Is_z2::value ? num_simplices_ : 0, z2_null_column()) {
     if (cpx_->num_simplices() > std::numeric_limits<Simplex_key>::max()) {
       // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
       throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
@@ -124,7 +156,7 @@ class Persistent_cohomology {
   }
 
   ~Persistent_cohomology() {
-    // Clean the transversal lists
+    // Clean the transversal lists, the Z/2Z ones own their memory
     for (auto & transverse_ref : transverse_idx_) {
       // Destruct all the cells
       transverse_ref.second.row_->clear_and_dispose([&](Cell*p){p->~Cell();});
@@ -181,7 +213,7 @@ class Persistent_cohomology {
           update_cohomology_groups_edge(sh);
           break;
         default:
-          update_cohomology_groups(sh, dim_simplex);
+          update_cohomology_groups(sh, dim_simplex, Is_z2());
           break;
       }
     }
@@ -192,22 +224,60 @@ class Persistent_cohomology {
 
       if (ds_parent_[key] == key  // root of its tree
       && zero_cocycles_.find(key) == zero_cocycles_.end()) {
-        persistent_pairs_.emplace_back(
+        add_pair(
             cpx_->simplex(key), cpx_->null_simplex(), coeff_field_.characteristic());
       }
     }
     for (auto zero_idx : zero_cocycles_) {
-      persistent_pairs_.emplace_back(
+      add_pair(
           cpx_->simplex(zero_idx.second), cpx_->null_simplex(), coeff_field_.characteristic());
     }
     // Compute infinite interval of dimension > 0
     for (auto cocycle : transverse_idx_) {
-      persistent_pairs_.emplace_back(
+      add_pair(
           cpx_->simplex(cocycle.first), cpx_->null_simplex(), cocycle.second.characteristics_);
     }
+    for (auto& row : z2_rows_) {
+      add_pair(
+          cpx_->simplex(row.first), cpx_->null_simplex(), coeff_field_.characteristic());
+    }
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex, and pass each persistent interval to pair_sink as soon as it is found, instead of storing it.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   * @param[in] pair_sink callable with a `const Persistent_interval&`. It receives the finite intervals by increasing
+   *                      death, then the infinite intervals.
+   * @param[in] dimension if non negative, pair_sink only receives the intervals of this dimension, i.e. the ones
+   *                      whose birth simplex has this dimension.
+   *
+   * The intervals are not kept: `get_persistent_pairs()`, `output_diagram()` and the Betti numbers see none of them.
+   * Use `output_interval()` in pair_sink to write the diagram incrementally. */
+  template <class PairSink>
+  void compute_persistent_cohomology(Filtration_value min_interval_length, PairSink pair_sink, int dimension = -1) {
+    Pair_sink_reset reset{pair_sink_};
+    pair_sink_ = std::move(pair_sink);
+    pair_sink_dimension_ = dimension;
+    compute_persistent_cohomology(min_interval_length);
   }
 
  private:
+  /* Clears pair_sink_ when compute_persistent_cohomology returns, or when the sink throws. */
+  struct Pair_sink_reset {
+    std::function<void(const Persistent_interval&)>& pair_sink;
+    ~Pair_sink_reset() { pair_sink = nullptr; }
+  };
+
+  /* Stores the persistent interval, or passes it to the sink of compute_persistent_cohomology if any. */
+  void add_pair(Simplex_handle birth, Simplex_handle death, Arith_element charac) {
+    if (!pair_sink_)
+      persistent_pairs_.emplace_back(birth, death, charac);
+    else if (pair_sink_dimension_ < 0 || static_cast<int>(cpx_->dimension(birth)) == pair_sink_dimension_)
+      pair_sink_(Persistent_interval(birth, death, charac));
+  }
+
   /** \brief Update the cohomology groups under the insertion of an edge.
    *
    * The 0-homology is maintained with a simple Union-Find data structure, which
@@ -243,7 +313,7 @@ class Persistent_cohomology {
       if (cpx_->filtration(cpx_->simplex(idx_coc_u))
           < cpx_->filtration(cpx_->simplex(idx_coc_v))) {  // Kill cocycle [idx_coc_v], which is younger.
         if (interval_length_policy(cpx_->simplex(idx_coc_v), sigma)) {
-          persistent_pairs_.emplace_back(
+          add_pair(
               cpx_->simplex(idx_coc_v), sigma, coeff_field_.characteristic());
         }
         // Maintain the index of the 0-cocycle alive.
@@ -258,7 +328,7 @@ class Persistent_cohomology {
         }
       } else {  // Kill cocycle [idx_coc_u], which is younger.
         if (interval_length_policy(cpx_->simplex(idx_coc_u), sigma)) {
-          persistent_pairs_.emplace_back(
+          add_pair(
               cpx_->simplex(idx_coc_u), sigma, coeff_field_.characteristic());
         }
         // Maintain the index of the 0-cocycle alive.
@@ -272,18 +342,35 @@ class Persistent_cohomology {
           zero_cocycles_[ku] = idx_coc_v;
         }
       }
-      cpx_->assign_key(sigma, cpx_->null_key());
     } else if (dim_max_ > 1) {  // If ku == kv, same connected component: create a 1-cocycle class.
-      create_cocycle(sigma, coeff_field_.multiplicative_identity(), coeff_field_.characteristic());
+      create_cocycle(sigma, coeff_field_.multiplicative_identity(), coeff_field_.characteristic(), Is_z2());
+    }
+  }
+
+  /*
+   * Call f on the keys of the facets of sigma, in the order of boundary_simplex_range, read from the boundary keys
+   * stored by the complex if it has them.
+   */
+  template <class F>
+  void for_each_boundary_key(Simplex_handle sigma, F&& f, std::true_type) {
+    if (cpx_->has_boundary_keys()) {
+      for (Simplex_key key : cpx_->boundary_keys(cpx_->key(sigma)))
+        f(key);
+    } else {
+      for_each_boundary_key(sigma, f, std::false_type());
     }
   }
 
+  template <class F>
+  void for_each_boundary_key(Simplex_handle sigma, F&& f, std::false_type) {
+    for (auto sh : cpx_->boundary_simplex_range(sigma))
+      f(cpx_->key(sh));
+  }
+
   /*
-   * Compute the annotation of the boundary of a simplex.
+   * Compute the annotation of the boundary of a simplex in a_ds_, sorted by key.
    */
-  void annotation_of_the_boundary(
-      std::map<Simplex_key, Arith_element> & map_a_ds, Simplex_handle sigma,
-      int dim_sigma) {
+  void annotation_of_the_boundary(Simplex_handle sigma, int dim_sigma) {
     // traverses the boundary of sigma, keeps track of the annotation vectors,
     // with multiplicity. We used to sum the coefficients directly in
     // annotations_in_boundary by using a map, we now do it later.
@@ -295,12 +382,12 @@ class Persistent_cohomology {
     annotations_in_boundary.clear();
     int sign = 1 - 2 * (dim_sigma % 2);  // \in {-1,1} provides the sign in the
                                          // alternate sum in the boundary.
-    Simplex_key key;
     Column * curr_col;
 
-    for (auto sh : cpx_->boundary_simplex_range(sigma)) {
-      key = cpx_->key(sh);
-      if (key != cpx_->null_key()) {  // A simplex with null_key is a killer, and have null annotation
+    for_each_boundary_key(sigma, [&](Simplex_key key) {
+      // A killer simplex never gets an annotation, its key is left untouched so that it remains its position in the
+      // filtration.
+      if (key != cpx_->null_key()) {
         // Find its annotation vector
         curr_col = ds_repr_[dsets_.find_set(key)];
         if (curr_col != NULL) {  // and insert it in annotations_in_boundary with multyiplicative factor "sign".
@@ -308,15 +395,14 @@ class Persistent_cohomology {
         }
       }
       sign = -sign;
-    }
+    }, Has_boundary_keys<FilteredComplex>());
     // Place identical annotations consecutively so we can easily sum their multiplicities.
     std::sort(annotations_in_boundary.begin(), annotations_in_boundary.end(),
               [](annotation_t const& a, annotation_t const& b) { return a.first < b.first; });
 
-    // Sum the annotations with multiplicity, using a map<key,coeff>
-    // to represent a sparse vector.
-    std::pair<typename std::map<Simplex_key, Arith_element>::iterator, bool> result_insert_a_ds;
-
+    // Sum the annotations with multiplicity in a_ds_, a sparse vector sorted by key. Each column is merged with the
+    // sum of the previous ones, in a_ds_buffer_, so that the storage of both is reused from a simplex to the next.
+    a_ds_.clear();
     for (auto ann_it = annotations_in_boundary.begin(); ann_it != annotations_in_boundary.end(); /**/) {
       Column* col = ann_it->first;
       int mult = ann_it->second;
@@ -325,19 +411,23 @@ class Persistent_cohomology {
       }
       // The following test is just a heuristic, it is not required, and it is fine that is misses p == 0.
       if (mult != coeff_field_.additive_identity()) {  // For all columns in the boundary,
-        for (auto cell_ref : col->col_) {  // insert every cell in map_a_ds with multiplicity
+        a_ds_buffer_.clear();
+        auto a_ds_it = a_ds_.begin();
+        for (auto& cell_ref : col->col_) {  // merge every cell with a_ds_, with multiplicity
+          while (a_ds_it != a_ds_.end() && a_ds_it->first < cell_ref.key_) {
+            a_ds_buffer_.push_back(std::move(*a_ds_it++));
+          }
           Arith_element w_y = coeff_field_.times(cell_ref.coefficient_, mult);  // coefficient * multiplicity
-
+          if (a_ds_it != a_ds_.end() && a_ds_it->first == cell_ref.key_) {  // if cell_ref.key_ already in a_ds_
+            w_y = coeff_field_.plus_equal(a_ds_it->second, w_y);
+            ++a_ds_it;
+          }
           if (w_y != coeff_field_.additive_identity()) {  // if != 0
-            result_insert_a_ds = map_a_ds.insert(std::pair<Simplex_key, Arith_element>(cell_ref.key_, w_y));
-            if (!(result_insert_a_ds.second)) {  // if cell_ref.key_ already a Key in map_a_ds
-              result_insert_a_ds.first->second = coeff_field_.plus_equal(result_insert_a_ds.first->second, w_y);
-              if (result_insert_a_ds.first->second == coeff_field_.additive_identity()) {
-                map_a_ds.erase(result_insert_a_ds.first);
-              }
-            }
+            a_ds_buffer_.emplace_back(cell_ref.key_, std::move(w_y));
           }
         }
+        a_ds_buffer_.insert(a_ds_buffer_.end(), std::make_move_iterator(a_ds_it), std::make_move_iterator(a_ds_.end()));
+        a_ds_.swap(a_ds_buffer_);
       }
     }
   }
@@ -345,40 +435,31 @@ class Persistent_cohomology {
   /*
    * Update the cohomology groups under the insertion of a simplex.
    */
-  void update_cohomology_groups(Simplex_handle sigma, int dim_sigma) {
+  void update_cohomology_groups(Simplex_handle sigma, int dim_sigma, std::false_type) {
 // Compute the annotation of the boundary of sigma:
-    std::map<Simplex_key, Arith_element> map_a_ds;
-    annotation_of_the_boundary(map_a_ds, sigma, dim_sigma);
+    annotation_of_the_boundary(sigma, dim_sigma);
 // Update the cohomology groups:
-    if (map_a_ds.empty()) {  // sigma is a creator in all fields represented in coeff_field_
+    if (a_ds_.empty()) {  // sigma is a creator in all fields represented in coeff_field_
       if (dim_sigma < dim_max_) {
         create_cocycle(sigma, coeff_field_.multiplicative_identity(),
-                       coeff_field_.characteristic());
+                       coeff_field_.characteristic(), std::false_type());
       }
     } else {        // sigma is a destructor in at least a field in coeff_field_
-      // Convert map_a_ds to a vector
-      A_ds_type a_ds;  // admits reverse iterators
-      for (auto map_a_ds_ref : map_a_ds) {
-        a_ds.push_back(
-            std::pair<Simplex_key, Arith_element>(map_a_ds_ref.first,
-                                                  map_a_ds_ref.second));
-      }
-
       Arith_element inv_x, charac;
       Arith_element prod = coeff_field_.characteristic();  // Product of characteristic of the fields
-      for (auto a_ds_rit = a_ds.rbegin();
-          (a_ds_rit != a_ds.rend())
+      for (auto a_ds_rit = a_ds_.rbegin();
+          (a_ds_rit != a_ds_.rend())
               && (prod != coeff_field_.multiplicative_identity()); ++a_ds_rit) {
         std::tie(inv_x, charac) = coeff_field_.inverse(a_ds_rit->second, prod);
 
         if (inv_x != coeff_field_.additive_identity()) {
-          destroy_cocycle(sigma, a_ds, a_ds_rit->first, inv_x, charac);
+          destroy_cocycle(sigma, a_ds_, a_ds_rit->first, inv_x, charac);
           prod /= charac;
         }
       }
       if (prod != coeff_field_.multiplicative_identity()
           && dim_sigma < dim_max_) {
-        create_cocycle(sigma, coeff_field_.multiplicative_identity(prod), prod);
+        create_cocycle(sigma, coeff_field_.multiplicative_identity(prod), prod, std::false_type());
       }
     }
   }
@@ -391,7 +472,7 @@ class Persistent_cohomology {
    * The new cocycle has value 0 on every simplex except on sigma
    * where it worths 1.*/
   void create_cocycle(Simplex_handle sigma, Arith_element x,
-                      Arith_element charac) {
+                      Arith_element charac, std::false_type) {
     Simplex_key key = cpx_->key(sigma);
     // Create a column containing only one cell,
     Column * new_col = column_pool_.construct(key);
@@ -421,7 +502,7 @@ class Persistent_cohomology {
                        Arith_element charac) {
     // Create a finite persistent interval for which the interval exists
     if (interval_length_policy(cpx_->simplex(death_key), sigma)) {
-      persistent_pairs_.emplace_back(cpx_->simplex(death_key)  // creator
+      add_pair(cpx_->simplex(death_key)  // creator
           , sigma                                              // destructor
           , charac);                                           // fields
     }
@@ -477,10 +558,6 @@ class Persistent_cohomology {
       }  // If w == 0, pass.
     }
 
-    // Because it is a killer simplex, set the data of sigma to null_key().
-    if (charac == coeff_field_.characteristic()) {
-      cpx_->assign_key(sigma, cpx_->null_key());
-    }
     if (death_key_row->second.characteristics_ == charac) {
       delete death_key_row->second.row_;
       transverse_idx_.erase(death_key_row);
@@ -536,6 +613,207 @@ class Persistent_cohomology {
     }
   }
 
+  /*
+   * Update the cohomology groups under the insertion of a simplex, with coefficients in Z/2Z.
+   */
+  void update_cohomology_groups(Simplex_handle sigma, int dim_sigma, std::true_type) {
+    z2_annotation_of_the_boundary(sigma);
+    if (z2_a_ds_.empty()) {  // sigma is a creator
+      if (dim_sigma < dim_max_) {
+        create_cocycle(sigma, coeff_field_.multiplicative_identity(), coeff_field_.characteristic(),
+                       std::true_type());
+      }
+    } else {  // sigma is a destructor, of the cocycle of highest key in the annotation of its boundary
+      z2_destroy_cocycle(sigma, z2_a_ds_.back());
+    }
+  }
+
+  /*
+   * Compute the annotation of the boundary of a simplex in z2_a_ds_, sorted by key.
+   */
+  void z2_annotation_of_the_boundary(Simplex_handle sigma) {
+    z2_boundary_columns_.clear();
+    for_each_boundary_key(sigma, [&](Simplex_key key) {
+      if (key != cpx_->null_key()) {
+        std::uint32_t col = z2_repr_[dsets_.find_set(key)];
+        if (col != z2_null_column()) z2_boundary_columns_.push_back(col);
+      }
+    }, Has_boundary_keys<FilteredComplex>());
+    // The columns appearing an even number of times cancel out.
+    std::sort(z2_boundary_columns_.begin(), z2_boundary_columns_.end());
+    auto last = z2_boundary_columns_.begin();
+    for (auto it = z2_boundary_columns_.begin(); it != z2_boundary_columns_.end();) {
+      auto next = it + 1;
+      while (next != z2_boundary_columns_.end() && *next == *it) ++next;
+      if ((next - it) % 2 == 1) *last++ = *it;
+      it = next;
+    }
+    z2_boundary_columns_.erase(last, z2_boundary_columns_.end());
+
+    z2_a_ds_.clear();
+    if (z2_boundary_columns_.size() == 1) {
+      z2_a_ds_ = z2_columns_[z2_boundary_columns_.front()].keys_;
+    } else if (z2_boundary_columns_.size() > 1) {
+      // Keep the keys that appear an odd number of times
+      for (std::uint32_t col : z2_boundary_columns_) {
+        const std::vector<Simplex_key>& keys = z2_columns_[col].keys_;
+        z2_a_ds_.insert(z2_a_ds_.end(), keys.begin(), keys.end());
+      }
+      std::sort(z2_a_ds_.begin(), z2_a_ds_.end());
+      auto last_key = z2_a_ds_.begin();
+      for (auto it = z2_a_ds_.begin(); it != z2_a_ds_.end();) {
+        if (it + 1 != z2_a_ds_.end() && *(it + 1) == *it) {
+          it += 2;
+        } else {
+          *last_key++ = *it++;
+        }
+      }
+      z2_a_ds_.erase(last_key, z2_a_ds_.end());
+    }
+  }
+
+  /*  \brief Create a new cocycle class, with coefficients in Z/2Z.*/
+  void create_cocycle(Simplex_handle sigma, Arith_element, Arith_element, std::true_type) {
+    Simplex_key key = cpx_->key(sigma);
+    std::uint32_t col = z2_new_column(key);
+    z2_columns_[col].keys_.push_back(key);
+    z2_cam_.emplace(z2_hash(z2_columns_[col].keys_), col);
+    // key is the biggest key used so far
+    Z2_row& row = z2_rows_.emplace_hint(z2_rows_.end(), key, Z2_row())->second;
+    row.columns.push_back(Z2_column_ref{col, z2_columns_[col].serial_});
+    z2_repr_[key] = col;
+  }
+
+  /*  \brief Destroy the cocycle class of key death_key, with coefficients in Z/2Z.
+   *
+   * z2_a_ds_ is added to all the columns that have a non-zero in the row of death_key, which zeros-out the row.*/
+  void z2_destroy_cocycle(Simplex_handle sigma, Simplex_key death_key) {
+    if (interval_length_policy(cpx_->simplex(death_key), sigma)) {
+      add_pair(cpx_->simplex(death_key), sigma, coeff_field_.characteristic());
+    }
+    // The row is removed first, no column gets a non-zero in it again.
+    auto death_key_row = z2_rows_.find(death_key);
+    std::vector<Z2_column_ref> row_columns(std::move(death_key_row->second.columns));
+    z2_rows_.erase(death_key_row);
+
+    for (const Z2_column_ref& ref : row_columns) {
+      Z2_column& curr_col = z2_columns_[ref.index];
+      // Obsolete references, and columns that appear twice in the row and were already reduced
+      if (curr_col.serial_ != ref.serial || !curr_col.contains(death_key)) continue;
+
+      z2_erase_from_cam(ref.index);
+      // Proceed to the reduction of the column, z2_new_keys_ gets the keys that were added
+      z2_plus_equal_column(curr_col);
+
+      if (curr_col.keys_.empty()) {  // If the column is null
+        z2_repr_[curr_col.class_key_] = z2_null_column();
+        z2_destroy_column(ref.index);
+        continue;
+      }
+      std::size_t hash = z2_hash(curr_col.keys_);
+      std::uint32_t identical = z2_null_column();
+      auto range = z2_cam_.equal_range(hash);
+      for (auto it = range.first; it != range.second && identical == z2_null_column(); ++it)
+        if (z2_columns_[it->second].keys_ == curr_col.keys_) identical = it->second;
+      if (identical == z2_null_column()) {  // If it was not in the CAM before
+        z2_cam_.emplace(hash, ref.index);
+        for (Simplex_key key : z2_new_keys_) z2_add_to_row(key, ref);
+      } else {  // There is already an identical column in the CAM: merge two disjoint sets.
+        Z2_column& identical_col = z2_columns_[identical];
+        dsets_.link(curr_col.class_key_, identical_col.class_key_);
+        Simplex_key key_tmp = dsets_.find_set(curr_col.class_key_);
+        z2_repr_[key_tmp] = identical;
+        identical_col.class_key_ = key_tmp;
+        z2_destroy_column(ref.index);
+      }
+    }
+  }
+
+  /*
+   * Assign:    target <- target + z2_a_ds_, and z2_new_keys_ <- the keys of z2_a_ds_ that were not in target.
+   */
+  void z2_plus_equal_column(Z2_column& target) {
+    z2_new_keys_.clear();
+    z2_sum_.clear();
+    auto target_it = target.keys_.begin(), target_end = target.keys_.end();
+    auto other_it = z2_a_ds_.begin(), other_end = z2_a_ds_.end();
+    while (target_it != target_end && other_it != other_end) {
+      if (*target_it < *other_it) {
+        z2_sum_.push_back(*target_it++);
+      } else if (*other_it < *target_it) {
+        z2_new_keys_.push_back(*other_it);
+        z2_sum_.push_back(*other_it++);
+      } else {
+        ++target_it;
+        ++other_it;
+      }
+    }
+    z2_sum_.insert(z2_sum_.end(), target_it, target_end);
+    z2_new_keys_.insert(z2_new_keys_.end(), other_it, other_end);
+    z2_sum_.insert(z2_sum_.end(), other_it, other_end);
+    target.keys_.swap(z2_sum_);
+  }
+
+  void z2_add_to_row(Simplex_key key, const Z2_column_ref& ref) {
+    Z2_row& row = z2_rows_.find(key)->second;
+    row.columns.push_back(ref);
+    if (row.columns.size() >= 2 * row.compacted_size + 8) {
+      // Remove the obsolete references, and the duplicates
+      std::sort(row.columns.begin(), row.columns.end(), [](const Z2_column_ref& a, const Z2_column_ref& b) {
+        return std::tie(a.index, a.serial) < std::tie(b.index, b.serial);
+      });
+      auto last = row.columns.begin();
+      for (auto it = row.columns.begin(); it != row.columns.end(); ++it) {
+        const Z2_column& col = z2_columns_[it->index];
+        if (col.serial_ == it->serial && col.contains(key) &&
+            (last == row.columns.begin() || (last - 1)->index != it->index))
+          *last++ = *it;
+      }
+      row.columns.erase(last, row.columns.end());
+      row.compacted_size = row.columns.size();
+    }
+  }
+
+  std::uint32_t z2_new_column(Simplex_key key) {
+    if (z2_free_columns_.empty()) {
+      if (z2_columns_.size() >= z2_null_column())
+        throw std::out_of_range("Persistent_cohomology - too many columns in Z/2Z");
+      z2_columns_.emplace_back(key);
+      return static_cast<std::uint32_t>(z2_columns_.size() - 1);
+    }
+    std::uint32_t col = z2_free_columns_.back();
+    z2_free_columns_.pop_back();
+    z2_columns_[col].class_key_ = key;
+    return col;
+  }
+
+  void z2_destroy_column(std::uint32_t col) {
+    std::vector<Simplex_key>().swap(z2_columns_[col].keys_);
+    ++z2_columns_[col].serial_;
+    z2_free_columns_.push_back(col);
+  }
+
+  void z2_erase_from_cam(std::uint32_t col) {
+    auto range = z2_cam_.equal_range(z2_hash(z2_columns_[col].keys_));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == col) {
+        z2_cam_.erase(it);
+        return;
+      }
+    }
+  }
+
+  static std::size_t z2_hash(const std::vector<Simplex_key>& keys) {
+    std::size_t seed = keys.size();
+    for (Simplex_key key : keys)
+      seed ^= std::hash<Simplex_key>()(key) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+
+  static std::uint32_t z2_null_column() {
+    return std::numeric_limits<std::uint32_t>::max();
+  }
+
   /*
    * Compare two intervals by length.
    */
@@ -564,17 +842,22 @@ class Persistent_cohomology {
   void output_diagram(std::ostream& ostream = std::cout) {
     cmp_intervals_by_length cmp(cpx_);
     std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
-    bool has_infinity = std::numeric_limits<Filtration_value>::has_infinity;
     for (auto pair : persistent_pairs_) {
-      // Special case on windows, inf is "1.#INF" (cf. unitary tests and R package TDA)
-      if (has_infinity && cpx_->filtration(get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
-        ostream << get<2>(pair) << "  " << cpx_->dimension(get<0>(pair)) << " "
-          << cpx_->filtration(get<0>(pair)) << " inf " << std::endl;
-      } else {
-        ostream << get<2>(pair) << "  " << cpx_->dimension(get<0>(pair)) << " "
-          << cpx_->filtration(get<0>(pair)) << " "
-          << cpx_->filtration(get<1>(pair)) << " " << std::endl;
-      }
+      output_interval(ostream, pair);
+    }
+  }
+
+  /** \brief Output a persistent interval in ostream, on a line in the format of `output_diagram()`. */
+  void output_interval(std::ostream& ostream, const Persistent_interval& pair) const {
+    // Special case on windows, inf is "1.#INF" (cf. unitary tests and R package TDA)
+    if (std::numeric_limits<Filtration_value>::has_infinity &&
+        cpx_->filtration(get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
+      ostream << get<2>(pair) << "  " << cpx_->dimension(get<0>(pair)) << " "
+        << cpx_->filtration(get<0>(pair)) << " inf \n";
+    } else {
+      ostream << get<2>(pair) << "  " << cpx_->dimension(get<0>(pair)) << " "
+        << cpx_->filtration(get<0>(pair)) << " "
+        << cpx_->filtration(get<1>(pair)) << " \n";
     }
   }
 
@@ -744,9 +1027,31 @@ class Persistent_cohomology {
   /* Persistent intervals. */
   std::vector<Persistent_interval> persistent_pairs_;
   length_interval interval_length_policy;
+  /* Receives the persistent intervals instead of persistent_pairs_, during compute_persistent_cohomology. */
+  std::function<void(const Persistent_interval&)> pair_sink_;
+  /* The dimension of the intervals passed to pair_sink_, all of them if negative. */
+  int pair_sink_dimension_ = -1;
+  /* The annotation of the boundary of the current simplex, and the buffer in which the annotations are summed. */
+  A_ds_type a_ds_;
+  A_ds_type a_ds_buffer_;
 
   Simple_object_pool<Column> column_pool_;
   Simple_object_pool<Cell> cell_pool_;
+
+  /* The compressed annotation matrix with coefficients in Z/2Z, see Field_Z2.
+   * z2_repr_ replaces ds_repr_ and holds the index of the annotation vectors in z2_columns_. The places of the
+   * destroyed columns are in z2_free_columns_. z2_cam_ finds the identical columns by their hash. */
+  std::vector<std::uint32_t> z2_repr_;
+  std::vector<Z2_column> z2_columns_;
+  std::vector<std::uint32_t> z2_free_columns_;
+  std::unordered_multimap<std::size_t, std::uint32_t> z2_cam_;
+  /*  Key -> row. */
+  std::map<Simplex_key, Z2_row> z2_rows_;
+  /* Buffers of the reductions. */
+  std::vector<std::uint32_t> z2_boundary_columns_;
+  std::vector<Simplex_key> z2_a_ds_;
+  std::vector<Simplex_key> z2_sum_;
+  std::vector<Simplex_key> z2_new_keys_;
 };
 
 }  // namespace persistent_cohomology
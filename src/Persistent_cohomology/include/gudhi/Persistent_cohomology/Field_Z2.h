@@ -0,0 +1,84 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_FIELD_Z2_H_
+#define PERSISTENT_COHOMOLOGY_FIELD_Z2_H_
+
+#include <gudhi/Debug_utils.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Structure representing the coefficient field \f$\mathbb{Z}/2\mathbb{Z}\f$.
+ *
+ * \implements CoefficientField
+ * \ingroup persistent_cohomology
+ *
+ * The operations are the ones of `Field_Zp` with \f$p = 2\f$, computed with bitwise operations. When it is the
+ * coefficient field of `Persistent_cohomology`, the compressed annotation matrix is specialized at compile time: the
+ * coefficients, which are all 1, are not stored, and a column is the sorted vector of the keys of its non-zero rows,
+ * so that the sum of two columns is their symmetric difference.
+ */
+class Field_Z2 {
+ public:
+  typedef int Element;
+
+  /** \brief Only checks, in debug mode, that the characteristic is 2. */
+  void init(int GUDHI_CHECK_code(charac)) {
+    GUDHI_CHECK(charac == 2, std::invalid_argument("Field_Z2::init - the characteristic must be 2"));
+  }
+
+  /** Set x <- x + w * y*/
+  Element plus_times_equal(const Element& x, const Element& y, const Element& w) const {
+    return x ^ (y & w & 1);
+  }
+
+  /** Returns y * w */
+  Element times(const Element& y, const Element& w) const {
+    return y & w & 1;
+  }
+
+  Element plus_equal(const Element& x, const Element& y) const {
+    return x ^ y;
+  }
+
+  /** \brief Returns the additive idendity \f$0_{\Bbbk}\f$ of the field.*/
+  Element additive_identity() const {
+    return 0;
+  }
+  /** \brief Returns the multiplicative identity \f$1_{\Bbbk}\f$ of the field.*/
+  Element multiplicative_identity(Element = 0) const {
+    return 1;
+  }
+  /** Returns the inverse in the field, and the characteristic P for which x is invertible. */
+  std::pair<Element, Element> inverse(Element x, Element P) const {
+    return std::pair<Element, Element>(x & 1, P);
+  }
+
+  /** Returns -x * y.*/
+  Element times_minus(Element x, Element y) const {
+    return x & y & 1;
+  }
+
+  /** \brief Returns the characteristic \f$p\f$ of the field.*/
+  int characteristic() const {
+    return 2;
+  }
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_FIELD_Z2_H_
@@ -22,6 +22,8 @@ namespace persistent_cohomology {
  *
  * \implements CoefficientField
  * \ingroup persistent_cohomology
+ *
+ * The characteristic is chosen at run time. When it is known at compile time, `Field_Zp_static` is faster.
  */
 class Field_Zp {
  public:
@@ -38,11 +40,12 @@ class Field_Zp {
     inverse_.clear();
     inverse_.reserve(charac);
     inverse_.push_back(0);
-    for (int i = 1; i < Prime; ++i) {
-      int inv = 1;
-      while (((inv * i) % Prime) != 1)
-        ++inv;
-      inverse_.push_back(inv);
+    if (Prime > 1)
+      inverse_.push_back(1);
+    // inv(i) = -(p / i) * inv(p % i), as p = (p / i) * i + p % i, in linear time instead of a search for each i
+    for (int i = 2; i < Prime; ++i) {
+      long long inv = Prime - (Prime / i) * static_cast<long long>(inverse_[Prime % i]) % Prime;
+      inverse_.push_back(static_cast<Element>(inv % Prime));
     }
   }
 
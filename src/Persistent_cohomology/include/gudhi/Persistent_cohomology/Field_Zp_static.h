@@ -0,0 +1,141 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_FIELD_ZP_STATIC_H_
+#define PERSISTENT_COHOMOLOGY_FIELD_ZP_STATIC_H_
+
+#include <gudhi/Debug_utils.h>
+
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+#include <stdexcept>
+#include <type_traits>  // for std::conditional
+#include <utility>
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Structure representing the coefficient field \f$\mathbb{Z}/p\mathbb{Z}\f$, for a prime \f$p\f$ fixed at
+ * compile time.
+ *
+ * \implements CoefficientField
+ * \ingroup persistent_cohomology
+ *
+ * The operations are the ones of `Field_Zp`, on elements in \f$[0, p)\f$, the factor w of `times` and
+ * `plus_times_equal` being possibly negative. As \f$p\f$ is a constant, the compiler replaces the reductions modulo
+ * \f$p\f$ by multiplications and shifts (Barrett reduction), and the products are computed on unsigned integers,
+ * without the corrections of the signed remainders. The inverses are a table computed at compile time when \f$p\f$
+ * is smaller than `max_table_prime`, and are computed by the extended Euclidean algorithm otherwise. `Field_Zp`
+ * remains the field to use when the prime is only known at run time.
+ *
+ * \tparam prime The characteristic \f$p\f$ of the field, which must be a prime smaller than \f$2^{31}\f$.
+ */
+template <int prime>
+class Field_Zp_static {
+  static_assert(prime > 1, "Field_Zp_static - the characteristic must be a prime");
+
+ public:
+  typedef int Element;
+
+  /** \brief The primes below which the inverses are a table computed at compile time. */
+  static constexpr int max_table_prime = 1 << 10;
+
+  /** \brief Only checks, in debug mode, that the characteristic is the prime of the template. */
+  void init(int GUDHI_CHECK_code(charac)) {
+    GUDHI_CHECK(charac == prime, std::invalid_argument("Field_Zp_static::init - the characteristic must be prime"));
+  }
+
+  /** Set x <- x + w * y*/
+  Element plus_times_equal(const Element& x, const Element& y, const Element& w) const {
+    return static_cast<Element>((static_cast<Wide>(x) + positive(w) * static_cast<Wide>(y)) % prime);
+  }
+
+  /** Returns y * w */
+  Element times(const Element& y, const Element& w) const {
+    return static_cast<Element>(static_cast<Wide>(y) * positive(w) % prime);
+  }
+
+  Element plus_equal(const Element& x, const Element& y) const {
+    Wide result = static_cast<Wide>(x) + static_cast<Wide>(y);
+    return static_cast<Element>(result >= prime ? result - prime : result);
+  }
+
+  /** \brief Returns the additive idendity \f$0_{\Bbbk}\f$ of the field.*/
+  Element additive_identity() const {
+    return 0;
+  }
+  /** \brief Returns the multiplicative identity \f$1_{\Bbbk}\f$ of the field.*/
+  Element multiplicative_identity(Element = 0) const {
+    return 1;
+  }
+  /** Returns the inverse in the field, and the characteristic P for which x is invertible. */
+  std::pair<Element, Element> inverse(Element x, Element P) const {
+    return std::pair<Element, Element>(inverse_of(x, std::integral_constant<bool, (prime < max_table_prime)>()), P);
+  }
+
+  /** Returns -x * y.*/
+  Element times_minus(Element x, Element y) const {
+    Element out = times(x, y);
+    return out == 0 ? 0 : prime - out;
+  }
+
+  /** \brief Returns the characteristic \f$p\f$ of the field.*/
+  int characteristic() const {
+    return prime;
+  }
+
+ private:
+  // Large enough for x + w * y, with x, y in [0, p) and w in [0, p].
+  typedef typename std::conditional<(prime < (1 << 15)), std::uint32_t, std::uint64_t>::type Wide;
+
+  // w, which may be a negative multiplicity of the boundary, as a representative in [0, p].
+  static Wide positive(Element w) {
+    return static_cast<Wide>(w < 0 ? w % prime + prime : w);
+  }
+
+  // The inverses of [0, p), 0 having 0 as inverse, by the recurrence inv(i) = -(p / i) * inv(p % i).
+  struct Inverse_table {
+    constexpr Inverse_table() : values() {
+      if (prime < max_table_prime) {
+        values[1] = 1;
+        for (int i = 2; i < prime; ++i)
+          values[i] = (prime - (prime / i) * values[prime % i] % prime) % prime;
+      }
+    }
+    Element values[prime < max_table_prime ? prime : 1];
+  };
+
+  static Element inverse_of(Element x, std::true_type) {
+    static constexpr Inverse_table table;
+    return table.values[x];
+  }
+
+  // Extended Euclidean algorithm, the coefficient of x in the Bezout identity of x and p.
+  static Element inverse_of(Element x, std::false_type) {
+    if (x == 0) return 0;
+    std::int64_t r0 = prime, r1 = x, t0 = 0, t1 = 1;
+    while (r1 != 0) {
+      std::int64_t q = r0 / r1;
+      std::int64_t r2 = r0 - q * r1;
+      r0 = r1;
+      r1 = r2;
+      std::int64_t t2 = t0 - q * t1;
+      t0 = t1;
+      t1 = t2;
+    }
+    return static_cast<Element>(t0 < 0 ? t0 + prime : t0);
+  }
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_FIELD_ZP_STATIC_H_
@@ -0,0 +1,208 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_MULTI_FIELD_SMALL_H_
+#define PERSISTENT_COHOMOLOGY_MULTI_FIELD_SMALL_H_
+
+#include <algorithm>  // for std::max
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::int64_t, std::uint64_t
+#include <stdexcept>  // for std::invalid_argument
+#include <vector>
+#include <utility>
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Structure representing coefficients in a set of finite fields simultaneously
+ * using the chinese remainder theorem, with 64-bit integers.
+ *
+ * \implements CoefficientField
+ * \ingroup persistent_cohomology
+ *
+ * The elements and the operations are the ones of `Multi_field`, but an element is a 64-bit integer instead of a GMP
+ * integer, so that an operation on the fields of all the primes is a few machine instructions, without allocation.
+ * The product of the primes must be smaller than \f$2^{62}\f$, e.g. all the primes up to 47. `Multi_field` does not
+ * have this limit, and requires GMP.
+ *
+ * Details on the algorithms may be found in \cite boissonnat:hal-00922572
+ */
+class Multi_field_small {
+ public:
+  typedef std::int64_t Element;
+
+  Multi_field_small()
+  : prod_characteristics_(0),
+    mult_id_all(0),
+    add_id_all(0) {
+  }
+
+  /** \brief Initialize the multi-field with the primes in [min_prime, max_prime].
+   *
+   * @exception std::invalid_argument if there is no such prime, or if their product is larger than \f$2^{62}\f$. */
+  void init(int min_prime, int max_prime) {
+    primes_.clear();
+    Uvect_.clear();
+    prod_characteristics_ = 1;
+    for (int p = std::max(min_prime, 2); p <= max_prime; ++p) {
+      if (!is_prime(p)) continue;
+      if (prod_characteristics_ > (Element(1) << 62) / p)
+        throw std::invalid_argument("Multi_field_small::init - the product of the primes exceeds 2^62");
+      primes_.push_back(p);
+      prod_characteristics_ *= p;
+    }
+    if (primes_.empty())
+      throw std::invalid_argument("Multi_field_small::init - no prime in [min_prime, max_prime]");
+
+    // Uvect_[i] = (Q / p_i)^(p_i - 1) mod Q, which is 1 modulo p_i and 0 modulo the other primes
+    for (auto p : primes_)
+      Uvect_.push_back(power(prod_characteristics_ / p, p - 1));
+    mult_id_all = 0;
+    for (auto uvect : Uvect_)
+      mult_id_all = (mult_id_all + uvect) % prod_characteristics_;
+  }
+
+  /** \brief Returns the additive idendity \f$0_{\Bbbk}\f$ of the field.*/
+  const Element& additive_identity() const {
+    return add_id_all;
+  }
+  /** \brief Returns the multiplicative identity \f$1_{\Bbbk}\f$ of the field.*/
+  const Element& multiplicative_identity() const {
+    return mult_id_all;
+  }  // 1 everywhere
+
+  Element multiplicative_identity(Element Q) const {
+    if (Q == prod_characteristics_) {
+      return multiplicative_identity();
+    }
+    Element mult_id = 0;
+    for (std::size_t idx = 0; idx < primes_.size(); ++idx) {
+      if ((Q % primes_[idx]) == 0) {
+        mult_id = (mult_id + Uvect_[idx]) % prod_characteristics_;
+      }
+    }
+    return mult_id;
+  }
+
+  /** Returns y * w */
+  Element times(const Element& y, const Element& w) const {
+    return mul_mod(y, positive(w));
+  }
+
+  Element plus_equal(const Element& x, const Element& y) const {
+    return (x + y) % prod_characteristics_;
+  }
+
+  /** \brief Returns the characteristic \f$p\f$ of the field.*/
+  const Element& characteristic() const {
+    return prod_characteristics_;
+  }
+
+  /** Returns the inverse in the field, and the product QT of the characteristics for which x is invertible. */
+  std::pair<Element, Element> inverse(Element x, Element QS) const {
+    Element QR = gcd(x, QS);
+    if (QR == QS)
+      return std::pair<Element, Element>(additive_identity(), multiplicative_identity());  // partial inverse is 0
+    Element QT = QS / QR;
+    Element inv_qt = inverse_modulo(x % QT, QT);
+    return { mul_mod(inv_qt, multiplicative_identity(QT)), QT };
+  }
+
+  /** Returns -x * y.*/
+  Element times_minus(const Element& x, const Element& y) const {
+    Element out = mul_mod(x, y);
+    return out == 0 ? 0 : prod_characteristics_ - out;
+  }
+
+  /** Set x <- x + w * y*/
+  Element plus_times_equal(const Element& x, const Element& y, const Element& w) const {
+    return (x + mul_mod(positive(w), y)) % prod_characteristics_;
+  }
+
+ private:
+  // w, which may be a negative multiplicity of the boundary, as a representative in [0, Q).
+  Element positive(Element w) const {
+    if (w >= 0 && w < prod_characteristics_) return w;
+    w %= prod_characteristics_;
+    return w < 0 ? w + prod_characteristics_ : w;
+  }
+
+  static bool is_prime(int n) {
+    for (int d = 2; d * d <= n; ++d)
+      if (n % d == 0) return false;
+    return n > 1;
+  }
+
+  static Element gcd(Element a, Element b) {
+    while (b != 0) {
+      Element r = a % b;
+      a = b;
+      b = r;
+    }
+    return a;
+  }
+
+  // Extended Euclidean algorithm, for x invertible modulo m.
+  static Element inverse_modulo(Element x, Element m) {
+    Element r0 = m, r1 = x, t0 = 0, t1 = 1;
+    while (r1 != 0) {
+      Element q = r0 / r1;
+      Element r2 = r0 - q * r1;
+      r0 = r1;
+      r1 = r2;
+      Element t2 = t0 - q * t1;
+      t0 = t1;
+      t1 = t2;
+    }
+    return t0 < 0 ? t0 + m : t0;
+  }
+
+  // x * y mod Q, for x and y in [0, Q).
+  Element mul_mod(Element x, Element y) const {
+#ifdef __SIZEOF_INT128__
+    // __extension__ so that -Wpedantic does not warn on the non standard type
+    __extension__ typedef unsigned __int128 Uint128;
+    return static_cast<Element>(static_cast<Uint128>(x) * static_cast<std::uint64_t>(y) %
+                                static_cast<std::uint64_t>(prod_characteristics_));
+#else
+    // Double and add, Q < 2^62 so that the sums do not overflow
+    Element result = 0;
+    for (; y != 0; y >>= 1) {
+      if (y & 1) result = (result + x) % prod_characteristics_;
+      x = (x << 1) % prod_characteristics_;
+    }
+    return result;
+#endif
+  }
+
+  Element power(Element x, int n) const {
+    Element result = 1 % prod_characteristics_;
+    for (; n != 0; n >>= 1) {
+      if (n & 1) result = mul_mod(result, x);
+      x = mul_mod(x, x);
+    }
+    return result;
+  }
+
+ public:
+  Element prod_characteristics_;  // product of characteristics of the fields
+                                  // represented by the multi-field class
+  std::vector<int> primes_;       // all the characteristics of the fields
+  std::vector<Element> Uvect_;
+  Element mult_id_all;
+  const Element add_id_all;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_MULTI_FIELD_SMALL_H_
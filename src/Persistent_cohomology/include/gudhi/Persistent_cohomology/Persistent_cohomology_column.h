@@ -14,7 +14,10 @@
 #include <boost/intrusive/set.hpp>
 #include <boost/intrusive/list.hpp>
 
+#include <algorithm>  // for std::binary_search
+#include <cstdint>
 #include <list>
+#include <vector>
 
 namespace Gudhi {
 
@@ -121,6 +124,33 @@ class Persistent_cohomology_column : public boost::intrusive::set_base_hook<
   SimplexKey class_key_;
 };
 
+/* 
+ * \brief Column of the Compressed Annotation Matrix with coefficients in Z/2Z, see Field_Z2.
+ *
+ * The coefficients, all equal to 1, are not stored: the column is the sorted
+ * vector of the keys of its non-zero rows, and the sum of two columns is their
+ * symmetric difference. The cells are not linked in rows, a row only refers to
+ * the columns that had a non-zero in it, with their serial number.
+ */
+template<typename SimplexKey>
+struct Persistent_cohomology_z2_column {
+  explicit Persistent_cohomology_z2_column(SimplexKey key)
+      : keys_(),
+        class_key_(key),
+        serial_(0) {}
+
+  /** \brief Returns true iff the column has a non-zero in the row of key.*/
+  bool contains(SimplexKey key) const {
+    return std::binary_search(keys_.begin(), keys_.end(), key);
+  }
+
+  std::vector<SimplexKey> keys_;
+  SimplexKey class_key_;
+  // Changed when the column is destroyed, so that the references to it from the rows are recognized as obsolete
+  // when its place is reused.
+  std::uint32_t serial_;
+};
+
 }  // namespace persistent_cohomology
 
 }  // namespace Gudhi
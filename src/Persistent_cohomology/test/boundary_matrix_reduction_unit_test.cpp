@@ -0,0 +1,220 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <tuple>
+#include <random>
+#include <cmath>  // for std::hypot
+#include <limits>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "boundary_matrix_reduction"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Boundary_matrix_reduction.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+using namespace Gudhi;
+using namespace Gudhi::persistent_cohomology;
+
+typedef Simplex_tree<> typeST;
+
+const Reduction_algorithm algorithms[] = {Reduction_algorithm::standard, Reduction_algorithm::twist,
+                                          Reduction_algorithm::cohomology, Reduction_algorithm::chunk};
+
+template<class Persistence>
+std::vector<std::tuple<int, double, double>> sorted_intervals(typeST& st, const Persistence& pers) {
+  std::vector<std::tuple<int, double, double>> intervals;
+  for (auto pair : pers.get_persistent_pairs())
+    intervals.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                           st.filtration(std::get<1>(pair)));
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+template<class CoefficientField>
+void check_same_pairs(typeST& st, int coefficient, double min_persistence, bool persistence_dim_max) {
+  Persistent_cohomology<typeST, CoefficientField> pcoh(st, persistence_dim_max);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  auto reference = sorted_intervals(st, pcoh);
+  BOOST_CHECK(!reference.empty());
+
+  for (Reduction_algorithm algorithm : algorithms) {
+    Boundary_matrix_reduction<typeST, CoefficientField> reduction(st, persistence_dim_max, algorithm);
+    BOOST_CHECK(reduction.algorithm() == algorithm);
+    // Many chunks, so that many columns are reduced after the chunks
+    reduction.set_num_chunks(7);
+    reduction.init_coefficients(coefficient);
+    reduction.compute_persistent_cohomology(min_persistence);
+    BOOST_CHECK(sorted_intervals(st, reduction) == reference);
+    BOOST_CHECK(reduction.betti_numbers() == pcoh.betti_numbers());
+    BOOST_CHECK(reduction.persistent_betti_numbers(0.1, 0.2) == pcoh.persistent_betti_numbers(0.1, 0.2));
+
+    // The same intervals passed to a sink, without being kept
+    std::vector<std::tuple<int, double, double>> streamed;
+    reduction.compute_persistent_cohomology(min_persistence, [&](const auto& pair) {
+      streamed.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                            st.filtration(std::get<1>(pair)));
+    });
+    std::sort(streamed.begin(), streamed.end());
+    BOOST_CHECK(streamed == reference);
+    BOOST_CHECK(reduction.get_persistent_pairs().empty());
+
+    // Only the intervals of dimension 1
+    streamed.clear();
+    reduction.compute_persistent_cohomology(min_persistence, [&](const auto& pair) {
+      streamed.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                            st.filtration(std::get<1>(pair)));
+    }, 1);
+    std::sort(streamed.begin(), streamed.end());
+    auto reference_dim_1 = reference;
+    reference_dim_1.erase(std::remove_if(reference_dim_1.begin(), reference_dim_1.end(),
+                                         [](const auto& interval) { return std::get<0>(interval) != 1; }),
+                          reference_dim_1.end());
+    BOOST_CHECK(streamed == reference_dim_1);
+  }
+}
+
+/* Flag complex of random points in the unit square, with many cycles created and killed. */
+typeST random_flag_complex(int num_points, double threshold, int max_dim) {
+  typeST st;
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < num_points; ++i) points.emplace_back(coord(gen), coord(gen));
+  for (int i = 0; i < num_points; ++i) st.insert_simplex({i}, 0.);
+  for (int i = 0; i < num_points; ++i)
+    for (int j = i + 1; j < num_points; ++j) {
+      double d = std::hypot(points[i].first - points[j].first, points[i].second - points[j].second);
+      if (d <= threshold) st.insert_simplex({i, j}, d);
+    }
+  st.expansion(max_dim);
+  st.initialize_filtration();
+  return st;
+}
+
+BOOST_AUTO_TEST_CASE( boundary_matrix_reduction_same_pairs_as_persistent_cohomology )
+{
+  // file is copied in CMakeLists.txt
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  typeST flag = random_flag_complex(80, 0.3, 3);
+
+  for (typeST* complex : {&st, &flag}) {
+    for (bool boundary_keys : {false, true}) {
+      complex->clear_boundary_keys();
+      if (boundary_keys) complex->initialize_boundary_keys();
+      for (bool persistence_dim_max : {false, true}) {
+        check_same_pairs<Field_Z2>(*complex, 2, 0., persistence_dim_max);
+        check_same_pairs<Field_Zp>(*complex, 2, 0.05, persistence_dim_max);
+        check_same_pairs<Field_Zp>(*complex, 3, 0., persistence_dim_max);
+        check_same_pairs<Field_Zp>(*complex, 5, 0.05, persistence_dim_max);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( boundary_matrix_reduction_chunks )
+{
+  typeST flag = random_flag_complex(100, 0.25, 3);
+  Boundary_matrix_reduction<typeST, Field_Zp> twist(flag, false, Reduction_algorithm::twist);
+  twist.init_coefficients(3);
+  twist.compute_persistent_cohomology();
+  auto reference = sorted_intervals(flag, twist);
+
+  // From a single chunk, to chunks of a single simplex
+  for (std::size_t num_chunks : {0, 1, 2, 5, 64, 1000000}) {
+    Boundary_matrix_reduction<typeST, Field_Zp> chunk(flag, false, Reduction_algorithm::chunk);
+    chunk.set_num_chunks(num_chunks);
+    chunk.init_coefficients(3);
+    chunk.compute_persistent_cohomology();
+    BOOST_CHECK(sorted_intervals(flag, chunk) == reference);
+  }
+}
+
+#ifdef GUDHI_USE_TBB
+BOOST_AUTO_TEST_CASE( boundary_matrix_reduction_chunks_in_parallel )
+{
+  // Workers are not limited by the number of cores, so that the chunks are also reduced concurrently on a single core
+  tbb::global_control parallelism(tbb::global_control::max_allowed_parallelism, 8);
+  typeST flag = random_flag_complex(100, 0.25, 3);
+  for (int coefficient : {2, 3}) {
+    Boundary_matrix_reduction<typeST, Field_Zp> twist(flag, false, Reduction_algorithm::twist);
+    twist.init_coefficients(coefficient);
+    twist.compute_persistent_cohomology();
+    auto reference = sorted_intervals(flag, twist);
+
+    for (int num_threads : {1, 2, 8}) {
+      tbb::task_arena arena(num_threads);
+      arena.execute([&] {
+        // One chunk per thread, and many more chunks than threads, so that many columns are left after the chunks
+        for (std::size_t num_chunks : {0, 100}) {
+          Boundary_matrix_reduction<typeST, Field_Zp> chunk(flag, false, Reduction_algorithm::chunk);
+          chunk.set_num_chunks(num_chunks);
+          chunk.init_coefficients(coefficient);
+          chunk.compute_persistent_cohomology();
+          BOOST_CHECK(sorted_intervals(flag, chunk) == reference);
+        }
+      });
+    }
+  }
+}
+#endif
+
+BOOST_AUTO_TEST_CASE( boundary_matrix_reduction_torsion )
+{
+  // Triangulation of the real projective plane: H1 = Z/2Z, so it has a 1-cycle and a 2-cycle only with Z/2Z.
+  typeST st;
+  const std::vector<std::vector<int>> triangles = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 5}, {0, 5, 1},
+                                                   {1, 2, 4}, {2, 3, 5}, {3, 4, 1}, {4, 5, 2}, {5, 1, 3}};
+  for (auto& triangle : triangles) st.insert_simplex_and_subfaces(triangle);
+  st.initialize_filtration();
+
+  for (Reduction_algorithm algorithm : algorithms) {
+    Boundary_matrix_reduction<typeST, Field_Z2> z2(st, true, algorithm);
+    z2.init_coefficients(2);
+    z2.compute_persistent_cohomology();
+    BOOST_CHECK(z2.betti_numbers() == std::vector<int>({1, 1, 1}));
+
+    Boundary_matrix_reduction<typeST, Field_Zp> z3(st, true, algorithm);
+    z3.init_coefficients(3);
+    z3.compute_persistent_cohomology();
+    BOOST_CHECK(z3.betti_numbers() == std::vector<int>({1, 0, 0}));
+  }
+}
+
+BOOST_AUTO_TEST_CASE( boundary_matrix_reduction_output_diagram )
+{
+  typeST flag = random_flag_complex(30, 0.4, 2);
+  Persistent_cohomology<typeST, Field_Zp> pcoh(flag);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Boundary_matrix_reduction<typeST, Field_Zp> reduction(flag);
+  reduction.init_coefficients(2);
+  reduction.compute_persistent_cohomology();
+
+  for (int dim = 0; dim < 2; ++dim) {
+    auto intervals = reduction.intervals_in_dimension(dim);
+    auto reference = pcoh.intervals_in_dimension(dim);
+    std::sort(intervals.begin(), intervals.end());
+    std::sort(reference.begin(), reference.end());
+    BOOST_CHECK(intervals == reference);
+  }
+  std::ostringstream output;
+  reduction.output_diagram(output);
+  std::string diagram = output.str();
+  BOOST_CHECK(std::count(diagram.begin(), diagram.end(), '\n') ==
+              static_cast<std::ptrdiff_t>(reduction.get_persistent_pairs().size()));
+}
@@ -5,6 +5,11 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <cstdint>  // for std::uint8_t
+#include <fstream>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <stdexcept>  // for std::runtime_error
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology"
@@ -166,6 +171,199 @@ BOOST_AUTO_TEST_CASE( rips_persistent_cohomology_single_field_dim_5 )
   test_rips_persistence_in_dimension(5);
 }
 
+BOOST_AUTO_TEST_CASE( rips_persistent_cohomology_with_boundary_keys )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+
+  for (int coefficient : {2, 3, 5}) {
+    st.clear_boundary_keys();
+    st.initialize_filtration();
+    Persistent_cohomology<typeST, Field_Zp> pcoh(st);
+    pcoh.init_coefficients(coefficient);
+    pcoh.compute_persistent_cohomology(0);
+    std::ostringstream reference;
+    pcoh.output_diagram(reference);
+
+    st.initialize_boundary_keys();
+    BOOST_CHECK(st.has_boundary_keys());
+    Persistent_cohomology<typeST, Field_Zp> pcoh_cached(st);
+    pcoh_cached.init_coefficients(coefficient);
+    pcoh_cached.compute_persistent_cohomology(0);
+    std::ostringstream cached;
+    pcoh_cached.output_diagram(cached);
+    BOOST_CHECK(cached.str() == reference.str());
+    BOOST_CHECK(pcoh_cached.persistent_betti_numbers(0., 10.) == pcoh.persistent_betti_numbers(0., 10.));
+  }
+}
+
+template<class CoefficientField>
+std::vector<std::tuple<int, double, double>> sorted_intervals(typeST& st, double min_persistence,
+                                                              int coefficient = 2) {
+  Persistent_cohomology<typeST, CoefficientField> pcoh(st);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  std::vector<std::tuple<int, double, double>> intervals;
+  for (auto pair : pcoh.get_persistent_pairs())
+    intervals.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                           st.filtration(std::get<1>(pair)));
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+BOOST_AUTO_TEST_CASE( rips_persistent_cohomology_field_z2 )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+
+  // A flag complex with many cycles created and killed
+  typeST flag;
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 60; ++i) points.emplace_back(coord(gen), coord(gen));
+  for (int i = 0; i < 60; ++i) flag.insert_simplex({i}, 0.);
+  for (int i = 0; i < 60; ++i)
+    for (int j = i + 1; j < 60; ++j) {
+      double d = std::hypot(points[i].first - points[j].first, points[i].second - points[j].second);
+      if (d <= 0.3) flag.insert_simplex({i, j}, d);
+    }
+  flag.expansion(3);
+
+  for (typeST* complex : {&st, &flag}) {
+    for (bool boundary_keys : {false, true}) {
+      complex->clear_boundary_keys();
+      complex->initialize_filtration();
+      if (boundary_keys) complex->initialize_boundary_keys();
+      for (double min_persistence : {0., 0.05}) {
+        auto reference = sorted_intervals<Field_Zp>(*complex, min_persistence);
+        auto z2 = sorted_intervals<Field_Z2>(*complex, min_persistence);
+        BOOST_CHECK(!z2.empty());
+        BOOST_CHECK(z2 == reference);
+      }
+    }
+  }
+}
+
+template<int prime>
+void test_field_zp_static() {
+  Field_Zp reference;
+  reference.init(prime);
+  Field_Zp_static<prime> field;
+  field.init(prime);
+  BOOST_CHECK(field.characteristic() == prime);
+  // Exhaustive for the small primes, on a sample of the elements for the large ones
+  int step = prime < 100 ? 1 : prime / 97;
+  for (int x = 0; x < prime; x += step) {
+    BOOST_CHECK(field.inverse(x, prime) == reference.inverse(x, prime));
+    if (x != 0) BOOST_CHECK(field.times(x, field.inverse(x, prime).first) == 1);
+    for (int y = 0; y < prime; y += step) {
+      BOOST_CHECK(field.plus_equal(x, y) == reference.plus_equal(x, y));
+      BOOST_CHECK(field.times_minus(x, y) == reference.times_minus(x, y));
+      // The multiplicities of the boundary may be negative
+      for (int w : {-3, -1, 0, 1, 2, prime - 1}) {
+        BOOST_CHECK(field.times(y, w) == reference.times(y, w));
+        BOOST_CHECK(field.plus_times_equal(x, y, w) == reference.plus_times_equal(x, y, w));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( field_zp_static_operations )
+{
+  test_field_zp_static<2>();
+  test_field_zp_static<3>();
+  test_field_zp_static<11>();
+  test_field_zp_static<1009>();
+  // Inverses by the extended Euclidean algorithm
+  test_field_zp_static<1031>();
+  test_field_zp_static<40009>();
+}
+
+BOOST_AUTO_TEST_CASE( rips_persistent_cohomology_field_zp_static )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (double min_persistence : {0., 0.05}) {
+    BOOST_CHECK(sorted_intervals<Field_Zp_static<2>>(st, min_persistence, 2) ==
+                sorted_intervals<Field_Zp>(st, min_persistence, 2));
+    BOOST_CHECK(sorted_intervals<Field_Zp_static<3>>(st, min_persistence, 3) ==
+                sorted_intervals<Field_Zp>(st, min_persistence, 3));
+    BOOST_CHECK(sorted_intervals<Field_Zp_static<1031>>(st, min_persistence, 1031) ==
+                sorted_intervals<Field_Zp>(st, min_persistence, 1031));
+  }
+}
+
+template<class CoefficientField>
+void test_persistent_pairs_sink(typeST& st, double min_persistence) {
+  Persistent_cohomology<typeST, CoefficientField> pcoh(st);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  std::ostringstream stored;
+  for (auto pair : pcoh.get_persistent_pairs()) pcoh.output_interval(stored, pair);
+
+  Persistent_cohomology<typeST, CoefficientField> pcoh_streamed(st);
+  pcoh_streamed.init_coefficients(2);
+  std::ostringstream streamed;
+  double last_death = 0.;
+  bool sorted_by_death = true;
+  pcoh_streamed.compute_persistent_cohomology(min_persistence, [&](const auto& pair) {
+    pcoh_streamed.output_interval(streamed, pair);
+    double death = st.filtration(std::get<1>(pair));
+    if (death < last_death) sorted_by_death = false;
+    last_death = death;
+  });
+  // The same intervals in the same order, the finite ones by increasing death, and none is kept
+  BOOST_CHECK(!stored.str().empty());
+  BOOST_CHECK(streamed.str() == stored.str());
+  BOOST_CHECK(sorted_by_death);
+  BOOST_CHECK(pcoh_streamed.get_persistent_pairs().empty());
+
+  // Only the intervals of one dimension
+  for (int dim : {0, 1}) {
+    std::ostringstream stored_dim, streamed_dim;
+    for (auto pair : pcoh.get_persistent_pairs())
+      if (st.dimension(std::get<0>(pair)) == dim) pcoh.output_interval(stored_dim, pair);
+    Persistent_cohomology<typeST, CoefficientField> pcoh_dim(st);
+    pcoh_dim.init_coefficients(2);
+    pcoh_dim.compute_persistent_cohomology(min_persistence, [&](const auto& pair) {
+      pcoh_dim.output_interval(streamed_dim, pair);
+    }, dim);
+    BOOST_CHECK(streamed_dim.str() == stored_dim.str());
+  }
+
+  // A sink that throws is not called by the next computation, which stores the intervals
+  Persistent_cohomology<typeST, CoefficientField> pcoh_throw(st);
+  pcoh_throw.init_coefficients(2);
+  BOOST_CHECK_THROW(pcoh_throw.compute_persistent_cohomology(min_persistence, [](const auto&) {
+    throw std::runtime_error("sink");
+  }), std::runtime_error);
+  BOOST_CHECK_NO_THROW(pcoh_throw.compute_persistent_cohomology(min_persistence));
+  BOOST_CHECK(!pcoh_throw.get_persistent_pairs().empty());
+}
+
+BOOST_AUTO_TEST_CASE( persistent_cohomology_pairs_sink )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (double min_persistence : {0., 0.5}) {
+    test_persistent_pairs_sink<Field_Zp>(st, min_persistence);
+    test_persistent_pairs_sink<Field_Z2>(st, min_persistence);
+  }
+}
+
 // TODO(VR): not working from 6
 // std::string str_rips_persistence = test_rips_persistence(6, 0);
 // TODO(VR): division by zero
@@ -183,6 +381,9 @@ struct MiniSTOptions {
   static const bool store_key = true;
   static const bool store_filtration = false;
   static const bool contiguous_vertices = false;
+  static const bool arena_allocation = false;
+  static const bool link_nodes_by_label = false;
+  static const bool packed_nodes = false;
 };
 
 using Mini_simplex_tree = Gudhi::Simplex_tree<MiniSTOptions>;
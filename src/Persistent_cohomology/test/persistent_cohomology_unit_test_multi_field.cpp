@@ -4,6 +4,9 @@
 #include <utility> // std::pair, std::make_pair
 #include <cmath> // float comparison
 #include <limits>
+#include <sstream>
+#include <stdexcept>  // for std::invalid_argument
+#include <vector>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology_multi_field"
@@ -14,6 +17,7 @@
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
 #include <gudhi/Persistent_cohomology/Multi_field.h>
+#include <gudhi/Persistent_cohomology/Multi_field_small.h>
 
 using namespace Gudhi;
 using namespace Gudhi::persistent_cohomology;
@@ -106,6 +110,39 @@ BOOST_AUTO_TEST_CASE(rips_persistent_cohomology_multi_field_dim_1_5) {
   test_rips_persistence_in_dimension(1, 5);
 }
 
+template<class CoefficientField>
+std::vector<std::string> sorted_diagram(typeST& st, int min_prime, int max_prime) {
+  Persistent_cohomology<typeST, CoefficientField> pcoh(st);
+  pcoh.init_coefficients(min_prime, max_prime);
+  pcoh.compute_persistent_cohomology(0.);
+  std::ostringstream output;
+  pcoh.output_diagram(output);
+  std::istringstream input(output.str());
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(input, line);) lines.push_back(line);
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+BOOST_AUTO_TEST_CASE(rips_persistent_cohomology_multi_field_small) {
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_multi_field_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  // Up to 47, the largest product of consecutive primes that fits in Multi_field_small
+  for (auto primes : {std::make_pair(2, 3), std::make_pair(2, 11), std::make_pair(5, 13), std::make_pair(2, 47)}) {
+    auto reference = sorted_diagram<Multi_field>(st, primes.first, primes.second);
+    BOOST_CHECK(!reference.empty());
+    BOOST_CHECK(sorted_diagram<Multi_field_small>(st, primes.first, primes.second) == reference);
+  }
+
+  Multi_field_small field;
+  BOOST_CHECK_THROW(field.init(2, 53), std::invalid_argument);
+  BOOST_CHECK_THROW(field.init(24, 28), std::invalid_argument);
+}
+
 // TODO(VR): not working from 6
 // std::string str_rips_persistence = test_rips_persistence(6, 0);
 // TODO(VR): division by zero
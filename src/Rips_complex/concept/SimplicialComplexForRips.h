@@ -48,6 +48,12 @@ struct SimplicialComplexForRips {
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex);
 
+  /** \brief Same as `expansion_with_blockers`, except that all the candidate simplices of a given dimension may be
+   * examined, concurrently, before those of the next dimension. `block_simplex` must therefore be safe to call from
+   * several threads on different simplices. */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex);
+
   /** \brief Returns a range over the vertices of a simplex.  */
   unspecified simplex_vertex_range(Simplex_handle sh);
 
@@ -163,6 +163,38 @@ namespace rips_complex {
  * 
  * 
  * 
+ * \section ripsstreamed Persistence without a simplex tree
+ *
+ * The simplices of a Rips complex, or of any flag complex, can be enumerated in filtration order directly from its
+ * 1-skeleton graph by `Gudhi::rips_complex::Flag_complex_stream`, which only stores the graph. The
+ * `Gudhi::rips_complex::Streamed_flag_complex` built from this stream, e.g. with
+ * `Gudhi::rips_complex::Rips_complex::create_streamed_complex`, is a model of `FilteredComplex` that stores 12
+ * bytes per simplex (with the default types) instead of a `Simplex_tree`: each simplex is encoded by its
+ * combinatorial number, and its key is its position in the filtration. It can be given to
+ * `Gudhi::persistent_cohomology::Persistent_cohomology`, but it cannot be modified, and the dimension is limited to
+ * 14.
+ *
+ * \include Rips_complex/example_streamed_rips_persistence.cpp
+ *
+ * When only the persistence diagram is needed, `Gudhi::rips_complex::Rips_persistence`, defined in
+ * `gudhi/Rips_persistence.h` and returned by `Gudhi::rips_complex::Rips_complex::create_persistence`, does not even
+ * store the simplices of the complex. It reduces the coboundaries dimension by dimension, enumerating the cofacets of a
+ * simplex from the graph, and only stores the simplices of the current dimension with the columns added during the
+ * reduction. The apparent pairs of zero persistence, where a simplex and its first cofacet have the same filtration
+ * value, are paired without any reduction. Its diagram is the same as the one of
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` on the `Simplex_tree`, as checked by the `-a implicit` option
+ * of the `rips_persistence` utility.
+ *
+ * \section ripssizeestimation Size of the complex before its construction
+ *
+ * The number of simplices of a Rips complex can be much larger than the number of edges of its graph.
+ * `Gudhi::rips_complex::Flag_complex_size_estimator`, returned by
+ * `Gudhi::rips_complex::Rips_complex::create_size_estimator`, counts them by dimension from the graph, much faster
+ * than the expansion and without storing them, and `Gudhi::rips_complex::estimated_memory_usage` predicts the memory
+ * of the `Simplex_tree` that would hold them. Given a memory budget,
+ * `Gudhi::rips_complex::Rips_complex::create_complex` can also lower the threshold of the Rips complex to the
+ * largest edge length whose complex fits, and return it.
+ *
  * \section ripsdistancematrix Distance matrix
  * 
  * \subsection ripsdistancematrixexample Example from a distance matrix
@@ -0,0 +1,38 @@
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Streamed_flag_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/distance_functions.h>
+
+#include <iostream>
+#include <vector>
+
+int main() {
+  using Point = std::vector<double>;
+  using Filtration_value = double;
+  using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+  using Streamed_flag_complex = Gudhi::rips_complex::Streamed_flag_complex<Filtration_value>;
+  using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+  using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Streamed_flag_complex, Field_Zp>;
+
+  std::vector<Point> points = {{1.0, 1.0},   {7.0, 0.0},  {4.0, 6.0},  {9.0, 6.0},
+                               {0.0, 14.0}, {2.0, 19.0}, {9.0, 17.0}};
+
+  // ----------------------------------------------------------------------------
+  // Init of a Rips complex from points, streamed in filtration order without a Simplex_tree
+  // ----------------------------------------------------------------------------
+  double threshold = 12.0;
+  Rips_complex rips_complex_from_points(points, threshold, Gudhi::Euclidean_distance());
+  Streamed_flag_complex complex = rips_complex_from_points.create_streamed_complex(2);
+
+  std::cout << "Rips complex is of dimension " << complex.dimension() << " - " << complex.num_simplices()
+            << " simplices - " << complex.num_vertices() << " vertices." << std::endl;
+
+  // ----------------------------------------------------------------------------
+  // Compute and display the persistence
+  // ----------------------------------------------------------------------------
+  Persistent_cohomology pcoh(complex);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  pcoh.output_diagram();
+  return 0;
+}
@@ -0,0 +1,351 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef FLAG_COMPLEX_SIZE_ESTIMATOR_H_
+#define FLAG_COMPLEX_SIZE_ESTIMATOR_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>  // for std::sort, std::unique
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>  // for std::swap
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/** \brief Number of simplices of a flag complex, as counted by `Flag_complex_size_estimator`.
+ *
+ * \ingroup rips_complex
+ */
+struct Flag_complex_size {
+  /** \brief Number of simplices of each dimension. */
+  std::vector<std::size_t> num_simplices;
+  /** \brief Number of simplices of each dimension that have cofaces in a `Simplex_tree`, i.e. a common neighbor with
+   * a larger label than all their vertices. Each of them owns a `Simplex_tree_siblings` holding these cofaces. */
+  std::vector<std::size_t> num_parents;
+  /** \brief False if the counting was stopped before the end, in which case the numbers are lower bounds. */
+  bool complete = true;
+
+  /** \brief Total number of simplices. */
+  std::size_t total() const {
+    std::size_t sum = 0;
+    for (std::size_t n : num_simplices) sum += n;
+    return sum;
+  }
+};
+
+/** \brief Estimated memory, in bytes, of a `Simplex_tree` holding the flag complex of size `size`, as returned by
+ * `Simplex_tree::memory_usage()` after `Simplex_tree::initialize_filtration()`.
+ *
+ * The nodes, the `Simplex_tree_siblings` and the filtration ordering are counted exactly, the memory allocated by the
+ * dictionaries beyond their size is not, nor are the additional structures of the options `link_nodes_by_label` and
+ * `packed_nodes`.
+ *
+ * \tparam SimplexTree is the `Simplex_tree` that will be built.
+ */
+template<class SimplexTree>
+std::size_t estimated_memory_usage(const Flag_complex_size& size) {
+  std::size_t bytes = size.total() * (sizeof(typename SimplexTree::Dictionary::value_type) +
+                                      sizeof(typename SimplexTree::Simplex_handle));
+  for (std::size_t n : size.num_parents) bytes += n * sizeof(typename SimplexTree::Siblings);
+  return bytes;
+}
+
+/**
+ * \class Flag_complex_size_estimator
+ * \brief Counts the simplices of the flag complex of a graph, or of its subgraphs below some thresholds, without
+ * building it, to predict the memory of its expansion before running it.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * The cliques are counted as a `Simplex_tree` stores them, each one below its smallest vertex. The neighbors of a
+ * vertex with larger labels are numbered locally, and the neighborhoods between them are stored as bitsets: the
+ * candidates to extend a clique are the intersection of the bitsets of its vertices, and the cliques of the maximal
+ * dimension are counted by a population count of their candidates, without being enumerated. The memory used is
+ * proportional to the size of the graph, plus the square of the largest neighborhood in bits.
+ *
+ * The counting is much faster than the expansion, but its time still grows with the number of simplices below the
+ * maximal dimension. `max_threshold()` stops the counting once the budget is exceeded.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values of the simplicial complex.
+ */
+template<typename Filtration_value>
+class Flag_complex_size_estimator {
+ public:
+  typedef int Vertex_handle;
+
+  /** \brief Flag_complex_size_estimator constructor from a graph.
+   *
+   * @param[in] skel_graph The 1-skeleton, as accepted by `Simplex_tree::insert_graph`, with vertices numbered from 0
+   * to `boost::num_vertices(skel_graph) - 1`, like the graph of a `Rips_complex`. If an edge appears several times,
+   * its smallest filtration value is kept.
+   * @param[in] max_dim Maximal dimension of the simplices.
+   * @exception std::invalid_argument If the graph has a self-loop.
+   *
+   * \tparam OneSkeletonGraph Model of <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/EdgeListGraph.html">
+   * boost::EdgeListGraph</a> and <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/VertexListGraph.html">
+   * boost::VertexListGraph</a> with properties `Gudhi::vertex_filtration_t` and `Gudhi::edge_filtration_t`.
+   */
+  template<class OneSkeletonGraph>
+  Flag_complex_size_estimator(const OneSkeletonGraph& skel_graph, int max_dim)
+      : vertex_filtrations_(boost::num_vertices(skel_graph)),
+        neighbors_begin_(boost::num_vertices(skel_graph) + 1, 0),
+        max_dim_(max_dim) {
+    for (auto vertex : boost::make_iterator_range(boost::vertices(skel_graph)))
+      vertex_filtrations_[vertex] = boost::get(vertex_filtration_t(), skel_graph, vertex);
+
+    std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> edges;
+    edges.reserve(boost::num_edges(skel_graph));
+    for (auto edge : boost::make_iterator_range(boost::edges(skel_graph))) {
+      Vertex_handle u = static_cast<Vertex_handle>(boost::source(edge, skel_graph));
+      Vertex_handle v = static_cast<Vertex_handle>(boost::target(edge, skel_graph));
+      if (u == v) throw std::invalid_argument("Flag_complex_size_estimator - self-loops are not simplicial");
+      if (v < u) std::swap(u, v);
+      edges.emplace_back(u, v, boost::get(edge_filtration_t(), skel_graph, edge));
+    }
+    // Sorted by vertices, the smallest filtration value of duplicated edges comes first and is kept.
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+                  return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+                }), edges.end());
+    neighbors_.reserve(edges.size());
+    for (const Edge& edge : edges) {
+      ++neighbors_begin_[std::get<0>(edge) + 1];
+      neighbors_.push_back(Neighbor{std::get<1>(edge), std::get<2>(edge)});
+    }
+    for (std::size_t v = 0; v < num_vertices(); ++v)
+      neighbors_begin_[v + 1] += neighbors_begin_[v];
+  }
+
+  /** \brief Returns the number of vertices. */
+  std::size_t num_vertices() const {
+    return vertex_filtrations_.size();
+  }
+
+  /** \brief Returns the number of edges, without duplicates. */
+  std::size_t num_edges() const {
+    return neighbors_.size();
+  }
+
+  /** \brief Returns the maximal dimension of the simplices. */
+  int max_dimension() const {
+    return max_dim_;
+  }
+
+  /** \brief Counts the simplices of the flag complex of the graph, by dimension. */
+  Flag_complex_size count_simplices() const {
+    return count(Filtration_value(), false, [](const Flag_complex_size&) { return false; });
+  }
+
+  /** \brief Counts the simplices of the flag complex of the subgraph made of the vertices and of the edges of
+   * filtration value at most `threshold`, by dimension. */
+  Flag_complex_size count_simplices(Filtration_value threshold) const {
+    return count(threshold, true, [](const Flag_complex_size&) { return false; });
+  }
+
+  /** \brief Returns the largest filtration value of a vertex or of an edge such that the flag complex of the
+   * subgraph below it fits in `max_bytes`, according to `memory`.
+   *
+   * The counts are done by dichotomy on the filtration values. Each one is stopped, between two vertices, as soon as
+   * the memory exceeds the budget, so that a graph whose expansion would not fit is not counted entirely.
+   *
+   * @param[in] max_bytes Memory budget, in bytes.
+   * @param[in] memory Estimates the memory of a complex from its `Flag_complex_size`, e.g.
+   * `estimated_memory_usage<Simplex_tree<>>`. It must not decrease when the numbers of simplices increase.
+   * @exception std::out_of_range If the vertices of smallest filtration value alone do not fit.
+   */
+  template<class Memory>
+  Filtration_value max_threshold(std::size_t max_bytes, Memory&& memory) const {
+    std::vector<Filtration_value> values(vertex_filtrations_);
+    for (const Neighbor& neighbor : neighbors_) values.push_back(neighbor.filtration);
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    auto exceeds = [&](const Flag_complex_size& size) { return memory(size) > max_bytes; };
+    // values[lower] fits, values[upper] does not
+    std::ptrdiff_t lower = -1, upper = static_cast<std::ptrdiff_t>(values.size());
+    while (upper - lower > 1) {
+      std::ptrdiff_t middle = lower + (upper - lower) / 2;
+      Flag_complex_size size = count(values[middle], true, exceeds);
+      if (size.complete && !exceeds(size))
+        lower = middle;
+      else
+        upper = middle;
+    }
+    if (lower < 0)
+      throw std::out_of_range("Flag_complex_size_estimator - the vertices alone exceed the memory budget");
+    return values[lower];
+  }
+
+ private:
+  typedef std::tuple<Vertex_handle, Vertex_handle, Filtration_value> Edge;
+
+  struct Neighbor {
+    Vertex_handle vertex;
+    Filtration_value filtration;
+  };
+
+  /* Bitsets of the local neighborhoods of a vertex, and of the candidates at each dimension. */
+  struct Workspace {
+    std::size_t num_words;
+    std::vector<std::uint64_t> rows;
+    std::vector<std::vector<std::uint64_t>> candidates;
+    // Local number of each vertex in the current neighborhood, or -1
+    std::vector<std::ptrdiff_t> local;
+    std::vector<Vertex_handle> neighborhood;
+    // Number of simplices counted when the stop condition is next checked
+    std::size_t next_check;
+    std::size_t counted;
+  };
+
+  static const std::size_t check_period = 1 << 16;
+
+  static int popcount(std::uint64_t word) {
+#ifdef __GNUC__
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word != 0; word &= word - 1) ++count;
+    return count;
+#endif
+  }
+
+  static int lowest_bit(std::uint64_t word) {
+#ifdef __GNUC__
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    for (; (word & 1) == 0; word >>= 1) ++bit;
+    return bit;
+#endif
+  }
+
+  /* Counts the simplices below threshold, or all of them if !below. stop(size) is called on the partial counts from
+   * time to time, the counting ends early if it returns true. */
+  template<class Stop>
+  Flag_complex_size count(Filtration_value threshold, bool below, Stop&& stop) const {
+    Flag_complex_size size;
+    if (max_dim_ < 0) return size;
+    size.num_simplices.assign(max_dim_ + 1, 0);
+    size.num_parents.assign(max_dim_ + 1, 0);
+    auto kept = [&](const Filtration_value& filt) { return !below || !(threshold < filt); };
+
+    Workspace ws;
+    ws.local.assign(num_vertices(), -1);
+    ws.candidates.resize(max_dim_ + 1);
+    ws.next_check = check_period;
+    ws.counted = 0;
+    for (std::size_t u = 0; u < num_vertices(); ++u) {
+      if (!kept(vertex_filtrations_[u])) continue;
+      ++size.num_simplices[0];
+      ws.neighborhood.clear();
+      for (std::size_t idx = neighbors_begin_[u]; idx < neighbors_begin_[u + 1]; ++idx)
+        if (kept(neighbors_[idx].filtration) && kept(vertex_filtrations_[neighbors_[idx].vertex]))
+          ws.neighborhood.push_back(neighbors_[idx].vertex);
+      if (ws.neighborhood.empty() || max_dim_ < 1) continue;
+      ++size.num_parents[0];
+      size.num_simplices[1] += ws.neighborhood.size();
+      ws.counted += ws.neighborhood.size() + 1;
+      if (max_dim_ >= 2) count_cliques_of_neighborhood(threshold, below, ws, size);
+      if (ws.counted >= ws.next_check) {
+        ws.next_check = ws.counted + check_period;
+        if (stop(static_cast<const Flag_complex_size&>(size))) {
+          size.complete = false;
+          return size;
+        }
+      }
+    }
+    return size;
+  }
+
+  /* Counts the cliques of dimension at least 2 made of a vertex and of its neighborhood with larger labels. */
+  void count_cliques_of_neighborhood(const Filtration_value& threshold, bool below, Workspace& ws,
+                                     Flag_complex_size& size) const {
+    const std::size_t num_local = ws.neighborhood.size();
+    ws.num_words = (num_local + 63) / 64;
+    ws.rows.assign(num_local * ws.num_words, 0);
+    for (std::size_t i = 0; i < num_local; ++i) ws.local[ws.neighborhood[i]] = static_cast<std::ptrdiff_t>(i);
+    // The row of i holds its neighbors j > i in the neighborhood
+    for (std::size_t i = 0; i < num_local; ++i) {
+      Vertex_handle v = ws.neighborhood[i];
+      for (std::size_t idx = neighbors_begin_[v]; idx < neighbors_begin_[v + 1]; ++idx) {
+        std::ptrdiff_t j = ws.local[neighbors_[idx].vertex];
+        if (j >= 0 && (!below || !(threshold < neighbors_[idx].filtration)))
+          ws.rows[i * ws.num_words + j / 64] |= std::uint64_t(1) << (j % 64);
+      }
+    }
+    for (Vertex_handle v : ws.neighborhood) ws.local[v] = -1;
+
+    for (std::size_t i = 0; i < num_local; ++i) {
+      const std::uint64_t* row = &ws.rows[i * ws.num_words];
+      std::size_t first_word = i / 64;
+      bool has_candidates = false;
+      for (std::size_t w = first_word; w < ws.num_words && !has_candidates; ++w) has_candidates = row[w] != 0;
+      if (!has_candidates) continue;
+      ++size.num_parents[1];
+      count_cofaces(row, first_word, 1, ws, size);
+    }
+  }
+
+  /* Counts the cofaces of a clique of dimension dim whose candidates, the local vertices that extend it, are the
+   * words of candidates from first_word on. */
+  void count_cofaces(const std::uint64_t* candidates, std::size_t first_word, int dim, Workspace& ws,
+                     Flag_complex_size& size) const {
+    if (dim + 1 == max_dim_) {
+      std::size_t num_cofaces = 0;
+      for (std::size_t w = first_word; w < ws.num_words; ++w) num_cofaces += popcount(candidates[w]);
+      size.num_simplices[dim + 1] += num_cofaces;
+      ws.counted += num_cofaces;
+      return;
+    }
+    std::vector<std::uint64_t>& next = ws.candidates[dim + 1];
+    next.resize(ws.num_words);
+    for (std::size_t w = first_word; w < ws.num_words; ++w) {
+      for (std::uint64_t bits = candidates[w]; bits != 0; bits &= bits - 1) {
+        std::size_t j = w * 64 + lowest_bit(bits);
+        ++size.num_simplices[dim + 1];
+        ++ws.counted;
+        // The candidates of the coface are the candidates larger than j that are neighbors of j
+        const std::uint64_t* row = &ws.rows[j * ws.num_words];
+        bool has_candidates = false;
+        for (std::size_t k = w; k < ws.num_words; ++k) {
+          next[k] = candidates[k] & row[k];
+          has_candidates = has_candidates || next[k] != 0;
+        }
+        if (has_candidates) {
+          ++size.num_parents[dim + 1];
+          count_cofaces(next.data(), w, dim + 1, ws, size);
+        }
+      }
+    }
+  }
+
+  std::vector<Filtration_value> vertex_filtrations_;
+  // Neighbors of each vertex with a larger label, sorted by vertex, starting at neighbors_begin_[vertex]
+  std::vector<std::size_t> neighbors_begin_;
+  std::vector<Neighbor> neighbors_;
+  int max_dim_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // FLAG_COMPLEX_SIZE_ESTIMATOR_H_
@@ -0,0 +1,219 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef FLAG_COMPLEX_STREAM_H_
+#define FLAG_COMPLEX_STREAM_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>  // for std::sort, std::unique
+#include <cstddef>
+#include <numeric>  // for std::iota
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Flag_complex_stream
+ * \brief Enumerates the simplices of the flag complex of a graph in filtration order, without storing them.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * The edges are sorted by filtration value. The simplices whose last edge in this order is \f$uv\f$ are the cliques
+ * made of \f$u\f$, \f$v\f$ and common neighbors of \f$u\f$ and \f$v\f$ through earlier edges. They are enumerated,
+ * faces before cofaces, right after \f$uv\f$, and get its filtration value. The vertices are enumerated before the
+ * first edge with a larger filtration value. The memory used is thus proportional to the size of the graph, and not
+ * to the number of simplices, as it would be in a `Simplex_tree` after `Simplex_tree::expansion()`.
+ *
+ * The filtration value of an edge must not be smaller than the ones of its vertices, as in a Rips complex.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values of the simplicial complex.
+ */
+template<typename Filtration_value>
+class Flag_complex_stream {
+ public:
+  typedef int Vertex_handle;
+
+  /** \brief Flag_complex_stream constructor from a graph.
+   *
+   * @param[in] skel_graph The 1-skeleton, as accepted by `Simplex_tree::insert_graph`, with vertices numbered from 0
+   * to `boost::num_vertices(skel_graph) - 1`, like the graph of a `Rips_complex`. If an edge appears several times,
+   * its smallest filtration value is kept.
+   * @param[in] max_dim Maximal dimension of the simplices.
+   * @exception std::invalid_argument If the graph has a self-loop.
+   *
+   * \tparam OneSkeletonGraph Model of <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/EdgeListGraph.html">
+   * boost::EdgeListGraph</a> and <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/VertexListGraph.html">
+   * boost::VertexListGraph</a> with properties `Gudhi::vertex_filtration_t` and `Gudhi::edge_filtration_t`.
+   */
+  template<class OneSkeletonGraph>
+  Flag_complex_stream(const OneSkeletonGraph& skel_graph, int max_dim)
+      : vertex_filtrations_(boost::num_vertices(skel_graph)),
+        neighbors_(boost::num_vertices(skel_graph)),
+        max_dim_(max_dim) {
+    for (auto vertex : boost::make_iterator_range(boost::vertices(skel_graph)))
+      vertex_filtrations_[vertex] = boost::get(vertex_filtration_t(), skel_graph, vertex);
+
+    edges_.reserve(boost::num_edges(skel_graph));
+    for (auto edge : boost::make_iterator_range(boost::edges(skel_graph))) {
+      Vertex_handle u = static_cast<Vertex_handle>(boost::source(edge, skel_graph));
+      Vertex_handle v = static_cast<Vertex_handle>(boost::target(edge, skel_graph));
+      if (u == v) throw std::invalid_argument("Flag_complex_stream - self-loops are not simplicial");
+      if (v < u) std::swap(u, v);
+      edges_.emplace_back(u, v, boost::get(edge_filtration_t(), skel_graph, edge));
+    }
+    // Keep the smallest filtration value of duplicated edges, then sort by filtration value.
+    std::sort(edges_.begin(), edges_.end());
+    edges_.erase(std::unique(edges_.begin(), edges_.end(), [](const Edge& a, const Edge& b) {
+                   return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+                 }), edges_.end());
+    std::sort(edges_.begin(), edges_.end(), [](const Edge& a, const Edge& b) {
+      return std::tie(std::get<2>(a), std::get<0>(a), std::get<1>(a)) <
+             std::tie(std::get<2>(b), std::get<0>(b), std::get<1>(b));
+    });
+
+    for (std::size_t idx = 0; idx < edges_.size(); ++idx) {
+      neighbors_[std::get<0>(edges_[idx])].push_back(Neighbor{std::get<1>(edges_[idx]), idx});
+      neighbors_[std::get<1>(edges_[idx])].push_back(Neighbor{std::get<0>(edges_[idx]), idx});
+    }
+    for (auto& neighbors : neighbors_)
+      std::sort(neighbors.begin(), neighbors.end(),
+                [](const Neighbor& a, const Neighbor& b) { return a.vertex < b.vertex; });
+  }
+
+  /** \brief Returns the number of vertices. */
+  std::size_t num_vertices() const {
+    return vertex_filtrations_.size();
+  }
+
+  /** \brief Returns the number of edges, without duplicates. */
+  std::size_t num_edges() const {
+    return edges_.size();
+  }
+
+  /** \brief Returns the maximal dimension of the simplices. */
+  int max_dimension() const {
+    return max_dim_;
+  }
+
+  /** \brief Calls `visitor(simplex, filtration)` on each simplex, in an order compatible with the filtration: by
+   * non-decreasing filtration value, and faces before cofaces.
+   *
+   * `simplex` is a `const std::vector<Vertex_handle>&` containing the vertices of the simplex in no particular order,
+   * valid only during the call, and `filtration` its `Filtration_value`.
+   */
+  template<class Visitor>
+  void for_each_simplex(Visitor&& visitor) const {
+    std::vector<Vertex_handle> vertices(num_vertices());
+    std::iota(vertices.begin(), vertices.end(), 0);
+    std::sort(vertices.begin(), vertices.end(), [this](Vertex_handle u, Vertex_handle v) {
+      return std::tie(vertex_filtrations_[u], u) < std::tie(vertex_filtrations_[v], v);
+    });
+
+    std::vector<Vertex_handle> simplex;
+    // candidates[k] holds the vertices that can be added to a simplex with k + 2 vertices.
+    std::vector<std::vector<Vertex_handle>> candidates(max_dim_ > 1 ? max_dim_ - 1 : 0);
+    auto next_vertex = vertices.begin();
+    for (std::size_t idx = 0; max_dim_ > 0 && idx < edges_.size(); ++idx) {
+      const Filtration_value& filt = std::get<2>(edges_[idx]);
+      for (; next_vertex != vertices.end() && !(filt < vertex_filtrations_[*next_vertex]); ++next_vertex)
+        visit_vertex(*next_vertex, simplex, visitor);
+
+      simplex.assign({std::get<0>(edges_[idx]), std::get<1>(edges_[idx])});
+      visitor(static_cast<const std::vector<Vertex_handle>&>(simplex), filt);
+      if (max_dim_ < 2) continue;
+      // Common neighbors of the endpoints through earlier edges
+      candidates[0].clear();
+      auto u_it = neighbors_[simplex[0]].begin(), u_end = neighbors_[simplex[0]].end();
+      auto v_it = neighbors_[simplex[1]].begin(), v_end = neighbors_[simplex[1]].end();
+      while (u_it != u_end && v_it != v_end) {
+        if (u_it->vertex < v_it->vertex) {
+          ++u_it;
+        } else if (v_it->vertex < u_it->vertex) {
+          ++v_it;
+        } else {
+          if (u_it->edge < idx && v_it->edge < idx) candidates[0].push_back(u_it->vertex);
+          ++u_it;
+          ++v_it;
+        }
+      }
+      visit_cofaces(simplex, candidates, 0, idx, filt, visitor);
+    }
+    for (; next_vertex != vertices.end(); ++next_vertex)
+      visit_vertex(*next_vertex, simplex, visitor);
+  }
+
+ private:
+  typedef std::tuple<Vertex_handle, Vertex_handle, Filtration_value> Edge;
+
+  struct Neighbor {
+    Vertex_handle vertex;
+    std::size_t edge;  // index in edges_
+  };
+
+  template<class Visitor>
+  void visit_vertex(Vertex_handle vertex, std::vector<Vertex_handle>& simplex, Visitor& visitor) const {
+    simplex.assign(1, vertex);
+    visitor(static_cast<const std::vector<Vertex_handle>&>(simplex), vertex_filtrations_[vertex]);
+  }
+
+  /* Visits the simplex plus the cliques of candidates[level]. Adding the candidates by increasing vertex, and
+   * recursing only in the smaller ones, visits the faces of a simplex before it. */
+  template<class Visitor>
+  void visit_cofaces(std::vector<Vertex_handle>& simplex, std::vector<std::vector<Vertex_handle>>& candidates,
+                     std::size_t level, std::size_t edge, const Filtration_value& filt, Visitor& visitor) const {
+    const std::vector<Vertex_handle>& current = candidates[level];
+    for (std::size_t pos = 0; pos < current.size(); ++pos) {
+      Vertex_handle w = current[pos];
+      simplex.push_back(w);
+      visitor(static_cast<const std::vector<Vertex_handle>&>(simplex), filt);
+      if (level + 1 < candidates.size() && pos > 0) {
+        // The smaller candidates that are neighbors of w through edges earlier than edge
+        std::vector<Vertex_handle>& next = candidates[level + 1];
+        next.clear();
+        auto ngb_it = neighbors_[w].begin(), ngb_end = neighbors_[w].end();
+        for (auto cand_it = current.begin(); cand_it != current.begin() + pos && ngb_it != ngb_end;) {
+          if (*cand_it < ngb_it->vertex) {
+            ++cand_it;
+          } else if (ngb_it->vertex < *cand_it) {
+            ++ngb_it;
+          } else {
+            if (ngb_it->edge < edge) next.push_back(*cand_it);
+            ++cand_it;
+            ++ngb_it;
+          }
+        }
+        if (!next.empty()) visit_cofaces(simplex, candidates, level + 1, edge, filt, visitor);
+      }
+      simplex.pop_back();
+    }
+  }
+
+  std::vector<Filtration_value> vertex_filtrations_;
+  // Sorted by filtration value
+  std::vector<Edge> edges_;
+  // Neighbors of each vertex, sorted by vertex, with the index of the edge
+  std::vector<std::vector<Neighbor>> neighbors_;
+  int max_dim_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // FLAG_COMPLEX_STREAM_H_
@@ -13,21 +13,36 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Streamed_flag_complex.h>
+#include <gudhi/Flag_complex_size_estimator.h>
 
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/range/iterator_range.hpp>
 
+#include <algorithm>  // for std::max
 #include <iostream>
 #include <vector>
 #include <map>
 #include <string>
 #include <limits>  // for numeric_limits
+#include <cstdint>  // for std::uint32_t
 #include <utility>  // for pair<>
 
 
 namespace Gudhi {
 
+namespace persistent_cohomology {
+
+class Field_Zp;
+
+}  // namespace persistent_cohomology
+
 namespace rips_complex {
 
+// Defined in gudhi/Rips_persistence.h, only needed by create_persistence
+template<typename FiltrationValue, class CoefficientField>
+class Rips_persistence;
+
 /**
  * \class Rips_complex
  * \brief Rips complex data structure.
@@ -108,6 +123,84 @@ class Rips_complex {
     complex.expansion(dim_max);
   }
 
+  /** \brief Initializes the simplicial complex from the Rips graph, restricted to its edges of length at most a
+   * lowered threshold, and expands it until a given maximal dimension, so that its memory fits in a given budget.
+   *
+   * The threshold is the largest edge length for which `Flag_complex_size_estimator` predicts a memory of at most
+   * `max_bytes`, see `estimated_memory_usage()`. If the whole expansion fits, it is the length of the longest edge
+   * and the complex is the one created by `create_complex(complex, dim_max)`.
+   *
+   * \tparam SimplicialComplexForRips must meet `SimplicialComplexForRips` concept, and be a `Simplex_tree` for the
+   * estimation of its memory.
+   *
+   * @param[in] complex SimplicialComplexForRips to be created.
+   * @param[in] dim_max graph expansion for Rips until this given maximal dimension.
+   * @param[in] max_bytes Memory budget of the complex, in bytes.
+   * @return The threshold of the created complex.
+   * @exception std::out_of_range If the vertices alone exceed the budget.
+   * @exception std::invalid_argument In debug mode, if `complex.num_vertices()` does not return 0.
+   */
+  template <typename SimplicialComplexForRips>
+  Filtration_value create_complex(SimplicialComplexForRips& complex, int dim_max, std::size_t max_bytes) {
+    GUDHI_CHECK(complex.num_vertices() == 0,
+                std::invalid_argument("Rips_complex::create_complex - simplicial complex is not empty"));
+
+    // insert_graph keeps the edges even if dim_max is 0
+    Filtration_value threshold = create_size_estimator(std::max(dim_max, 1)).max_threshold(
+        max_bytes, estimated_memory_usage<SimplicialComplexForRips>);
+    std::vector<std::pair<Vertex_handle, Vertex_handle>> edges;
+    std::vector<Filtration_value> edges_fil;
+    for (auto edge : boost::make_iterator_range(boost::edges(rips_skeleton_graph_))) {
+      Filtration_value fil = boost::get(edge_filtration_t(), rips_skeleton_graph_, edge);
+      if (fil <= threshold) {
+        edges.emplace_back(static_cast<Vertex_handle>(boost::source(edge, rips_skeleton_graph_)),
+                           static_cast<Vertex_handle>(boost::target(edge, rips_skeleton_graph_)));
+        edges_fil.push_back(fil);
+      }
+    }
+    if (edges.size() == boost::num_edges(rips_skeleton_graph_)) {
+      create_complex(complex, dim_max);
+      return threshold;
+    }
+    OneSkeletonGraph graph(edges.begin(), edges.end(), edges_fil.begin(), boost::num_vertices(rips_skeleton_graph_));
+    for (auto vertex : boost::make_iterator_range(boost::vertices(graph)))
+      boost::put(vertex_filtration_t(), graph, vertex, boost::get(vertex_filtration_t(), rips_skeleton_graph_, vertex));
+    complex.insert_graph(graph);
+    complex.expansion(dim_max);
+    return threshold;
+  }
+
+  /** \brief Returns a `Flag_complex_size_estimator` of the Rips graph, to count the simplices of the Rips complex
+   * expanded until a given maximal dimension, and of its subcomplexes of lower thresholds, before creating it.
+   */
+  Flag_complex_size_estimator<Filtration_value> create_size_estimator(int dim_max) const {
+    return Flag_complex_size_estimator<Filtration_value>(rips_skeleton_graph_, dim_max);
+  }
+
+  /** \brief Returns the Rips complex expanded until a given maximal dimension, as a `Streamed_flag_complex` from
+   * which the persistence can be computed without building a `Simplex_tree`.
+   *
+   * @param[in] dim_max Maximal dimension of the simplices, at most 14.
+   *
+   * \tparam SimplexKey is the integer type of the keys, that limits the number of simplices.
+   */
+  template <typename SimplexKey = std::uint32_t>
+  Streamed_flag_complex<Filtration_value, SimplexKey> create_streamed_complex(int dim_max) const {
+    return Streamed_flag_complex<Filtration_value, SimplexKey>(rips_skeleton_graph_, dim_max);
+  }
+
+  /** \brief Returns a `Rips_persistence` of the Rips complex expanded until a given maximal dimension, that computes
+   * its persistence without building it. Requires to include `gudhi/Rips_persistence.h`.
+   *
+   * @param[in] dim_max Maximal dimension of the simplices.
+   *
+   * \tparam CoefficientField is the coefficient field of the persistence.
+   */
+  template <class CoefficientField = persistent_cohomology::Field_Zp>
+  Rips_persistence<Filtration_value, CoefficientField> create_persistence(int dim_max) const {
+    return Rips_persistence<Filtration_value, CoefficientField>(rips_skeleton_graph_, dim_max);
+  }
+
  private:
   /** \brief Computes the proximity graph of the points.
    *
@@ -0,0 +1,528 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef RIPS_PERSISTENCE_H_
+#define RIPS_PERSISTENCE_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Persistent_cohomology/Field_Zp.h>
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>  // for std::sort, std::max, std::upper_bound, std::push_heap, std::pop_heap
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // for std::function
+#include <iostream>
+#include <limits>  // for infinity value
+#include <numeric>  // for std::iota
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>  // for pair
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Rips_persistence
+ * \brief Persistent cohomology of the flag complex of a graph, computed without building the complex.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * A simplex is only a pair (diameter, index), where the index is the combinatorial number
+ * \f$\sum_i \binom{v_i}{i+1}\f$ of its vertices \f$v_0 < \cdots < v_d\f$. Its cofacets are enumerated from the
+ * neighbors of its vertices in the graph, and the coboundary matrix is reduced dimension by dimension, with the
+ * clearing optimization, as in the <a href="https://github.com/Ripser/ripser">Ripser</a> software of U. Bauer. Only
+ * the simplices of one dimension, and the combinations of columns added during the reduction, are stored.
+ *
+ * The simplices are in the order of their dimension, then of their diameter, then of their decreasing index. When
+ * the first cofacet of a simplex in this order has the same diameter, and is not yet the pivot of another column,
+ * the two form an apparent pair of zero persistence, which is paired without computing the rest of the coboundary.
+ *
+ * The number of vertices \f$n\f$ and the maximal dimension \f$d\f$ are limited by the indices:
+ * \f$\binom{n}{d+1}\f$ must be smaller than \f$2^{63}\f$.
+ *
+ * \tparam FiltrationValue is the type used to store the filtration values of the simplicial complex.
+ * \tparam CoefficientField is the coefficient field, a model of `CoefficientField`, e.g. `Field_Zp` or `Field_Z2`.
+ */
+template<typename FiltrationValue = double, class CoefficientField = persistent_cohomology::Field_Zp>
+class Rips_persistence {
+ public:
+  typedef FiltrationValue Filtration_value;
+  typedef int Vertex_handle;
+  typedef typename CoefficientField::Element Arith_element;
+  /** \brief Persistence interval, as its dimension, its birth and its death, which is infinite for the essential
+   * classes. */
+  typedef std::tuple<int, Filtration_value, Filtration_value> Persistent_interval;
+
+  /** \brief Rips_persistence constructor from a graph.
+   *
+   * @param[in] skel_graph The 1-skeleton, whose edges have a filtration value not smaller than the ones of their
+   * vertices.
+   * @param[in] dim_max Maximal dimension of the simplices. The persistence is computed in the dimensions smaller
+   * than dim_max. As `Rips_complex::create_complex` always inserts the edges, dim_max 0 is the same as 1.
+   * @exception std::invalid_argument If the graph has self-loops.
+   * @exception std::out_of_range If the simplices cannot be indexed, see above.
+   *
+   * \tparam OneSkeletonGraph Model of <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/EdgeListGraph.html">
+   * boost::EdgeListGraph</a> and <a href="http://www.boost.org/doc/libs/1_65_1/libs/graph/doc/VertexListGraph.html">
+   * boost::VertexListGraph</a> with properties `Gudhi::vertex_filtration_t` and `Gudhi::edge_filtration_t`.
+   */
+  template<class OneSkeletonGraph>
+  Rips_persistence(const OneSkeletonGraph& skel_graph, int dim_max)
+      : vertex_filtrations_(boost::num_vertices(skel_graph)),
+        dim_max_(std::max(dim_max, 1)),
+        num_apparent_pairs_(0) {
+    std::size_t num_vertices = vertex_filtrations_.size();
+    for (auto vertex : boost::make_iterator_range(boost::vertices(skel_graph)))
+      vertex_filtrations_[vertex] = boost::get(vertex_filtration_t(), skel_graph, vertex);
+
+    std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> edges;
+    edges.reserve(2 * boost::num_edges(skel_graph));
+    for (auto edge : boost::make_iterator_range(boost::edges(skel_graph))) {
+      Vertex_handle u = static_cast<Vertex_handle>(boost::source(edge, skel_graph));
+      Vertex_handle v = static_cast<Vertex_handle>(boost::target(edge, skel_graph));
+      if (u == v) throw std::invalid_argument("Rips_persistence - self-loops are not simplicial");
+      Filtration_value filt = boost::get(edge_filtration_t(), skel_graph, edge);
+      edges.emplace_back(u, v, filt);
+      edges.emplace_back(v, u, filt);
+    }
+    // Keep the smallest filtration value of duplicated edges.
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+                  return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+                }), edges.end());
+
+    // The neighbors of each vertex, sorted by vertex.
+    neighbor_begin_.assign(num_vertices + 1, 0);
+    neighbors_.reserve(edges.size());
+    for (auto& edge : edges) {
+      ++neighbor_begin_[std::get<0>(edge) + 1];
+      neighbors_.push_back(Neighbor{std::get<1>(edge), std::get<2>(edge)});
+    }
+    for (std::size_t v = 0; v < num_vertices; ++v) neighbor_begin_[v + 1] += neighbor_begin_[v];
+
+    compute_binomials(num_vertices, dim_max_ + 1);
+    if (binomials_[dim_max_ + 1][num_vertices] >= max_index_)
+      throw std::out_of_range("Rips_persistence - too many vertices to index the simplices");
+  }
+
+  /** \brief Initializes the coefficient field.*/
+  void init_coefficients(int charac) {
+    coeff_field_.init(charac);
+  }
+
+  /** \brief Compute the persistent homology of the flag complex.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * Assumes that the field of coefficients has been initialized with init_coefficients(int).
+   */
+  void compute_persistent_cohomology(Filtration_value min_interval_length = 0) {
+    persistent_pairs_.clear();
+    num_apparent_pairs_ = 0;
+    minus_one_ = coeff_field_.times_minus(coeff_field_.multiplicative_identity(),
+                                          coeff_field_.multiplicative_identity());
+
+    std::vector<Simplex> simplices, columns_to_reduce;
+    compute_dim_0_pairs(simplices, columns_to_reduce, min_interval_length);
+    for (int dim = 1; dim < dim_max_; ++dim) {
+      compute_pairs(columns_to_reduce, dim, min_interval_length);
+      if (dim + 1 < dim_max_) assemble_columns_to_reduce(simplices, columns_to_reduce, dim);
+    }
+    pivot_owners_.clear();
+    release(reduction_entries_);
+    release(reduction_begin_);
+    release(working_coboundary_);
+  }
+
+  /** \brief Compute the persistent homology of the flag complex, and pass each persistent interval to pair_sink as
+   * soon as it is found, instead of storing it.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   * @param[in] pair_sink callable with a `const Persistent_interval&`. It receives the intervals dimension by
+   *                      dimension, from 0 up.
+   * @param[in] dimension if non negative, pair_sink only receives the intervals of this dimension.
+   *
+   * The intervals are not kept. Use `output_interval()` in pair_sink to write the diagram incrementally. */
+  template <class PairSink>
+  void compute_persistent_cohomology(Filtration_value min_interval_length, PairSink pair_sink, int dimension = -1) {
+    Pair_sink_reset reset{pair_sink_};
+    pair_sink_ = std::move(pair_sink);
+    pair_sink_dimension_ = dimension;
+    compute_persistent_cohomology(min_interval_length);
+  }
+
+  /** \brief Returns the persistent intervals, with the ones of length at most min_interval_length discarded. */
+  const std::vector<Persistent_interval>& get_persistent_pairs() const {
+    return persistent_pairs_;
+  }
+
+  /** \brief Returns the number of apparent pairs, which were paired without any reduction. */
+  std::size_t num_apparent_pairs() const {
+    return num_apparent_pairs_;
+  }
+
+  /** \brief Output the persistence diagram in ostream, in the format of
+   * `Persistent_cohomology::output_diagram()`. */
+  void output_diagram(std::ostream& ostream = std::cout) {
+    std::sort(persistent_pairs_.begin(), persistent_pairs_.end(),
+              [](const Persistent_interval& p1, const Persistent_interval& p2) {
+                return std::get<2>(p1) - std::get<1>(p1) > std::get<2>(p2) - std::get<1>(p2);
+              });
+    for (auto& pair : persistent_pairs_) output_interval(ostream, pair);
+  }
+
+  /** \brief Output a persistent interval in ostream, in the format of
+   * `Persistent_cohomology::output_interval()`. */
+  void output_interval(std::ostream& ostream, const Persistent_interval& pair) const {
+    ostream << coeff_field_.characteristic() << "  " << std::get<0>(pair) << " " << std::get<1>(pair) << " ";
+    if (std::numeric_limits<Filtration_value>::has_infinity &&
+        std::get<2>(pair) == std::numeric_limits<Filtration_value>::infinity())
+      ostream << "inf \n";
+    else
+      ostream << std::get<2>(pair) << " \n";
+  }
+
+  /** @brief Returns Betti numbers, in the dimensions smaller than dim_max. */
+  std::vector<int> betti_numbers() const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto& pair : persistent_pairs_)
+      if (std::get<2>(pair) == std::numeric_limits<Filtration_value>::infinity()) ++betti_numbers[std::get<0>(pair)];
+    return betti_numbers;
+  }
+
+  /** @brief Returns the persistence intervals of a dimension, as (birth, death) pairs. */
+  std::vector<std::pair<Filtration_value, Filtration_value>> intervals_in_dimension(int dimension) const {
+    std::vector<std::pair<Filtration_value, Filtration_value>> result;
+    for (auto& pair : persistent_pairs_)
+      if (std::get<0>(pair) == dimension) result.emplace_back(std::get<1>(pair), std::get<2>(pair));
+    return result;
+  }
+
+ private:
+  typedef std::tuple<Vertex_handle, Vertex_handle, Filtration_value> Edge;
+
+  struct Neighbor {
+    Vertex_handle vertex;
+    Filtration_value filtration;
+  };
+
+  struct Simplex {
+    Filtration_value diameter;
+    std::uint64_t index;
+  };
+
+  struct Entry {
+    Simplex simplex;
+    Arith_element coefficient;
+  };
+
+  // Order of the simplices of a dimension in the filtration.
+  static bool comes_before(const Simplex& a, const Simplex& b) {
+    return a.diameter < b.diameter || (a.diameter == b.diameter && a.index > b.index);
+  }
+
+  // The heap of the working coboundary has the first simplex in the filtration on top.
+  static bool comes_after(const Entry& a, const Entry& b) {
+    return comes_before(b.simplex, a.simplex);
+  }
+
+  static constexpr std::uint64_t max_index_ = std::uint64_t(1) << 63;
+
+  void compute_binomials(std::size_t num_vertices, int max_k) {
+    // binomials_[k][n] is binomial(n, k), capped to max_index_ which is larger than any valid index.
+    binomials_.assign(max_k + 1, std::vector<std::uint64_t>(num_vertices + 1, 0));
+    for (std::size_t n = 0; n <= num_vertices; ++n) {
+      binomials_[0][n] = 1;
+      for (int k = 1; k <= max_k && static_cast<std::size_t>(k) <= n; ++k)
+        binomials_[k][n] = std::min(max_index_, binomials_[k - 1][n - 1] + binomials_[k][n - 1]);
+    }
+  }
+
+  // Writes the vertices of a simplex of dimension dim in decreasing order in vertices_.
+  void decode(std::uint64_t index, int dim) {
+    vertices_.resize(dim + 1);
+    // The largest vertex v such that binomial(v, k) <= index is the k-th vertex.
+    auto upper = binomials_[dim + 1].end();
+    for (int k = dim + 1; k > 0; --k) {
+      auto next = std::upper_bound(binomials_[k].begin(), upper, index);
+      Vertex_handle vertex = static_cast<Vertex_handle>(next - binomials_[k].begin()) - 1;
+      vertices_[dim + 1 - k] = vertex;
+      index -= binomials_[k][vertex];
+      upper = binomials_[k - 1].begin() + vertex;
+    }
+  }
+
+  // Calls visitor(cofacet, coefficient) on the cofacets of a simplex of dimension dim, in the order of decreasing
+  // index, until it returns false. With only_larger_vertices, only the cofacets whose added vertex is larger than
+  // all the vertices of the simplex are visited, so that each simplex is the cofacet of exactly one simplex.
+  template<class Visitor>
+  void for_each_cofacet(const Simplex& simplex, int dim, bool only_larger_vertices, Visitor&& visitor) {
+    decode(simplex.index, dim);
+    // The common neighbors w of the vertices are found by walking backwards in their sorted neighbors.
+    cursors_.resize(dim + 1);
+    for (int i = 0; i <= dim; ++i) cursors_[i] = neighbors_.data() + neighbor_begin_[vertices_[i] + 1];
+    const Neighbor* first_neighbor = neighbors_.data() + neighbor_begin_[vertices_[0]];
+    // The index of the cofacet is the sum of the terms of the vertices above w, which are shifted by one position,
+    // the term of w, and the terms of the k vertices below w.
+    std::uint64_t index_above = 0, index_below = simplex.index;
+    int k = dim + 1;
+    while (cursors_[0] != first_neighbor) {
+      const Neighbor& candidate = *--cursors_[0];
+      Vertex_handle w = candidate.vertex;
+      if (only_larger_vertices && w < vertices_[0]) return;
+      Filtration_value diameter = std::max(simplex.diameter, candidate.filtration);
+      bool is_common_neighbor = true;
+      for (int i = 1; i <= dim && is_common_neighbor; ++i) {
+        const Neighbor* first = neighbors_.data() + neighbor_begin_[vertices_[i]];
+        const Neighbor*& cursor = cursors_[i];
+        while (cursor != first && (cursor - 1)->vertex > w) --cursor;
+        if (cursor == first) return;  // no smaller common neighbor
+        is_common_neighbor = (cursor - 1)->vertex == w;
+        if (is_common_neighbor) diameter = std::max(diameter, (cursor - 1)->filtration);
+      }
+      if (!is_common_neighbor) continue;
+      for (; k > 0 && vertices_[dim + 1 - k] > w; --k) {
+        index_below -= binomials_[k][vertices_[dim + 1 - k]];
+        index_above += binomials_[k + 1][vertices_[dim + 1 - k]];
+      }
+      // The sign of the facet in the boundary of the cofacet depends on the number of vertices above w.
+      Arith_element coefficient = (dim + 1 - k) % 2 ? minus_one_ : coeff_field_.multiplicative_identity();
+      if (!visitor(Simplex{diameter, index_above + binomials_[k + 1][w] + index_below}, coefficient)) return;
+    }
+  }
+
+  // Pairs the vertices and the edges with a union-find, by the elder rule. The edges that close a cycle are the
+  // columns to reduce in dimension 1.
+  void compute_dim_0_pairs(std::vector<Simplex>& edges, std::vector<Simplex>& columns_to_reduce,
+                           Filtration_value min_interval_length) {
+    std::size_t num_vertices = vertex_filtrations_.size();
+    edges.clear();
+    columns_to_reduce.clear();
+    for (std::size_t v = 0; v < num_vertices; ++v)
+      for (std::size_t pos = neighbor_begin_[v]; pos < neighbor_begin_[v + 1]; ++pos)
+        if (neighbors_[pos].vertex > static_cast<Vertex_handle>(v))
+          edges.push_back(Simplex{neighbors_[pos].filtration, binomials_[2][neighbors_[pos].vertex] + v});
+    std::sort(edges.begin(), edges.end(), comes_before);
+
+    std::vector<Vertex_handle> parent(num_vertices);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](Vertex_handle v) {
+      while (parent[v] != v) v = parent[v] = parent[parent[v]];
+      return v;
+    };
+    for (auto& edge : edges) {
+      decode(edge.index, 1);
+      Vertex_handle u = find_root(vertices_[0]), v = find_root(vertices_[1]);
+      if (u == v) {
+        columns_to_reduce.push_back(edge);
+        continue;
+      }
+      // The component born last dies.
+      if (comes_before(Simplex{vertex_filtrations_[u], static_cast<std::uint64_t>(u)},
+                       Simplex{vertex_filtrations_[v], static_cast<std::uint64_t>(v)}))
+        std::swap(u, v);
+      if (edge.diameter - vertex_filtrations_[u] > min_interval_length)
+        store_pair(0, vertex_filtrations_[u], edge.diameter);
+      parent[u] = v;
+    }
+    for (std::size_t v = 0; v < num_vertices; ++v)
+      if (parent[v] == static_cast<Vertex_handle>(v))
+        store_pair(0, vertex_filtrations_[v], std::numeric_limits<Filtration_value>::infinity());
+    std::reverse(columns_to_reduce.begin(), columns_to_reduce.end());
+  }
+
+  // Replaces the simplices of dimension dim by the ones of dimension dim + 1, and lists in columns_to_reduce those
+  // that are not the pivot of a column, in the reverse order of the filtration.
+  void assemble_columns_to_reduce(std::vector<Simplex>& simplices, std::vector<Simplex>& columns_to_reduce, int dim) {
+    std::vector<Simplex> cofacets;
+    columns_to_reduce.clear();
+    for (auto& simplex : simplices)
+      for_each_cofacet(simplex, dim, true, [&](const Simplex& cofacet, Arith_element) {
+        cofacets.push_back(cofacet);
+        if (pivot_owners_.find(cofacet.index) == pivot_owners_.end()) columns_to_reduce.push_back(cofacet);
+        return true;
+      });
+    simplices.swap(cofacets);
+    std::sort(columns_to_reduce.begin(), columns_to_reduce.end(),
+              [](const Simplex& a, const Simplex& b) { return comes_before(b, a); });
+    pivot_owners_.clear();
+  }
+
+  // Reduces the coboundaries of the columns to reduce, in the reverse order of the filtration. A column is
+  // represented by the combination of the simplices whose coboundaries were added to it, from which its coboundary
+  // is enumerated again when it is added to another column.
+  void compute_pairs(const std::vector<Simplex>& columns_to_reduce, int dim, Filtration_value min_interval_length) {
+    pivot_owners_.clear();
+    pivot_owners_.reserve(columns_to_reduce.size());
+    reduction_entries_.clear();
+    reduction_begin_.assign(1, 0);
+    for (std::size_t column = 0; column < columns_to_reduce.size(); ++column) {
+      const Simplex& simplex = columns_to_reduce[column];
+      working_reduction_.clear();
+      Entry pivot;
+      bool has_pivot = init_coboundary_and_get_pivot(simplex, dim, pivot);
+      while (has_pivot) {
+        auto owner = pivot_owners_.find(pivot.simplex.index);
+        if (owner == pivot_owners_.end()) break;
+        Arith_element inverse = coeff_field_.inverse(owner->second.second, coeff_field_.characteristic()).first;
+        Arith_element factor = coeff_field_.times_minus(pivot.coefficient, inverse);
+        std::size_t other = owner->second.first;
+        add_coboundary(columns_to_reduce[other], factor, dim);
+        for (std::size_t pos = reduction_begin_[other]; pos < reduction_begin_[other + 1]; ++pos)
+          add_coboundary(reduction_entries_[pos].simplex,
+                         coeff_field_.times(reduction_entries_[pos].coefficient, factor), dim);
+        has_pivot = get_pivot(pivot);
+      }
+
+      if (has_pivot) {
+        pivot_owners_.emplace(pivot.simplex.index, std::make_pair(column, pivot.coefficient));
+        if (pivot.simplex.diameter - simplex.diameter > min_interval_length)
+          store_pair(dim, simplex.diameter, pivot.simplex.diameter);
+        store_working_reduction();
+      } else {
+        store_pair(dim, simplex.diameter, std::numeric_limits<Filtration_value>::infinity());
+      }
+      reduction_begin_.push_back(reduction_entries_.size());
+    }
+  }
+
+  // Fills the working coboundary with the coboundary of the simplex and gets its pivot, unless it forms an apparent
+  // pair with its first cofacet.
+  bool init_coboundary_and_get_pivot(const Simplex& simplex, int dim, Entry& pivot) {
+    working_coboundary_.clear();
+    bool check_apparent_pair = true, is_apparent_pair = false;
+    for_each_cofacet(simplex, dim, false, [&](const Simplex& cofacet, Arith_element coefficient) {
+      if (check_apparent_pair && cofacet.diameter == simplex.diameter) {
+        if (pivot_owners_.find(cofacet.index) == pivot_owners_.end()) {
+          pivot = Entry{cofacet, coefficient};
+          is_apparent_pair = true;
+          return false;
+        }
+        check_apparent_pair = false;
+      }
+      working_coboundary_.push_back(Entry{cofacet, coefficient});
+      return true;
+    });
+    if (is_apparent_pair) {
+      ++num_apparent_pairs_;
+      return true;
+    }
+    std::make_heap(working_coboundary_.begin(), working_coboundary_.end(), comes_after);
+    return get_pivot(pivot);
+  }
+
+  // Adds factor times the coboundary of the simplex to the working coboundary.
+  void add_coboundary(const Simplex& simplex, Arith_element factor, int dim) {
+    working_reduction_.push_back(Entry{simplex, factor});
+    for_each_cofacet(simplex, dim, false, [&](const Simplex& cofacet, Arith_element coefficient) {
+      working_coboundary_.push_back(Entry{cofacet, coeff_field_.times(coefficient, factor)});
+      std::push_heap(working_coboundary_.begin(), working_coboundary_.end(), comes_after);
+      return true;
+    });
+  }
+
+  // Pops the entries of the first simplex of the working coboundary, until their sum is not zero, and leaves their
+  // sum on the heap.
+  bool get_pivot(Entry& pivot) {
+    while (!working_coboundary_.empty()) {
+      pivot = pop_entry();
+      while (!working_coboundary_.empty() && working_coboundary_.front().simplex.index == pivot.simplex.index)
+        pivot.coefficient = coeff_field_.plus_equal(pivot.coefficient, pop_entry().coefficient);
+      if (pivot.coefficient != coeff_field_.additive_identity()) {
+        working_coboundary_.push_back(pivot);
+        std::push_heap(working_coboundary_.begin(), working_coboundary_.end(), comes_after);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Entry pop_entry() {
+    std::pop_heap(working_coboundary_.begin(), working_coboundary_.end(), comes_after);
+    Entry entry = working_coboundary_.back();
+    working_coboundary_.pop_back();
+    return entry;
+  }
+
+  // Appends the working reduction, with its entries of the same simplex summed, to the reduction entries.
+  void store_working_reduction() {
+    std::sort(working_reduction_.begin(), working_reduction_.end(),
+              [](const Entry& a, const Entry& b) { return a.simplex.index < b.simplex.index; });
+    for (auto it = working_reduction_.begin(); it != working_reduction_.end();) {
+      Entry entry = *it;
+      for (++it; it != working_reduction_.end() && it->simplex.index == entry.simplex.index; ++it)
+        entry.coefficient = coeff_field_.plus_equal(entry.coefficient, it->coefficient);
+      if (entry.coefficient != coeff_field_.additive_identity()) reduction_entries_.push_back(entry);
+    }
+  }
+
+  template<class Container>
+  static void release(Container& container) {
+    Container().swap(container);
+  }
+
+  // Clears pair_sink_ when compute_persistent_cohomology returns, or when the sink throws.
+  struct Pair_sink_reset {
+    std::function<void(const Persistent_interval&)>& pair_sink;
+    ~Pair_sink_reset() { pair_sink = nullptr; }
+  };
+
+  // Stores the persistent interval, or passes it to the sink of compute_persistent_cohomology if any.
+  void store_pair(int dim, Filtration_value birth, Filtration_value death) {
+    if (!pair_sink_)
+      persistent_pairs_.emplace_back(dim, birth, death);
+    else if (pair_sink_dimension_ < 0 || dim == pair_sink_dimension_)
+      pair_sink_(Persistent_interval(dim, birth, death));
+  }
+
+  std::vector<Filtration_value> vertex_filtrations_;
+  // The neighbors of vertex v, sorted by vertex, are in [neighbor_begin_[v], neighbor_begin_[v + 1]).
+  std::vector<std::size_t> neighbor_begin_;
+  std::vector<Neighbor> neighbors_;
+  std::vector<std::vector<std::uint64_t>> binomials_;
+  int dim_max_;
+  CoefficientField coeff_field_;
+  Arith_element minus_one_;
+  std::vector<Persistent_interval> persistent_pairs_;
+  // Receives the persistent intervals instead of persistent_pairs_, during compute_persistent_cohomology.
+  std::function<void(const Persistent_interval&)> pair_sink_;
+  // The dimension of the intervals passed to pair_sink_, all of them if negative.
+  int pair_sink_dimension_ = -1;
+  std::size_t num_apparent_pairs_;
+
+  // For each pivot of the current dimension, the column that owns it and its coefficient.
+  std::unordered_map<std::uint64_t, std::pair<std::size_t, Arith_element>> pivot_owners_;
+  // For each reduced column with a pivot, the simplices whose coboundaries were added to it, with their factors.
+  std::vector<Entry> reduction_entries_;
+  std::vector<std::size_t> reduction_begin_;
+  std::vector<Entry> working_reduction_;
+  // Heap of the entries of the working coboundary, whose entries of the same simplex are summed lazily.
+  std::vector<Entry> working_coboundary_;
+  std::vector<Vertex_handle> vertices_;
+  std::vector<const Neighbor*> cursors_;
+};
+
+template<typename FiltrationValue, class CoefficientField>
+constexpr std::uint64_t Rips_persistence<FiltrationValue, CoefficientField>::max_index_;
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // RIPS_PERSISTENCE_H_
@@ -124,7 +124,7 @@ class Sparse_rips_complex {
       }
       return false;
     };
-    complex.expansion_with_blockers(dim_max, block);
+    complex.parallel_expansion_with_blockers(dim_max, block);
   }
 
  private:
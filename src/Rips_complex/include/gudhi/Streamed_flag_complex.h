@@ -0,0 +1,337 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef STREAMED_FLAG_COMPLEX_H_
+#define STREAMED_FLAG_COMPLEX_H_
+
+#include <gudhi/Flag_complex_stream.h>
+#include <gudhi/Debug_utils.h>
+
+#include <boost/container/static_vector.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>  // for std::sort, std::lower_bound, std::upper_bound
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>  // for infinity value
+#include <numeric>  // for std::iota
+#include <stdexcept>
+#include <utility>  // for pair
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Streamed_flag_complex
+ * \brief Filtered flag complex of a graph, built from a `Flag_complex_stream` without any `Simplex_tree`, to compute
+ * its persistence.
+ *
+ * \implements FilteredComplex
+ * \ingroup rips_complex
+ *
+ * \details
+ * A `Simplex_handle` is the position of the simplex in the filtration, which is also its key. The simplices come in
+ * the order of `Flag_complex_stream::for_each_simplex()`, so they need not be sorted, and each one is stored as a
+ * single 64 bits integer, from which its vertices and its facets are computed when asked. With the sorted index
+ * used to find the facets, this takes 12 bytes per simplex, a few times less than a `Simplex_tree` and its
+ * filtration order.
+ *
+ * The number of vertices \f$n\f$ and the dimension \f$d\f$ of the complex are limited by the encoding:
+ * \f$\binom{n}{d+1}\f$ must be smaller than \f$2^{60}\f$, e.g. about 100 000 vertices in dimension 3.
+ *
+ * \tparam FiltrationValue is the type used to store the filtration values of the simplicial complex.
+ * \tparam SimplexKey is the integer type of the keys, that limits the number of simplices.
+ */
+template<typename FiltrationValue = double, typename SimplexKey = std::uint32_t>
+class Streamed_flag_complex {
+ public:
+  typedef FiltrationValue Filtration_value;
+  typedef SimplexKey Simplex_key;
+  typedef int Vertex_handle;
+  /** \brief Position of the simplex in the filtration. */
+  typedef SimplexKey Simplex_handle;
+
+  typedef boost::counting_iterator<Simplex_handle> Filtration_simplex_iterator;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
+
+ private:
+  static const int max_dimension_ = 14;
+
+ public:
+  /** \brief Range over the facets of a simplex. */
+  typedef boost::container::static_vector<Simplex_handle, max_dimension_ + 1> Boundary_simplex_range;
+  /** \brief Range over the vertices of a simplex. */
+  typedef boost::container::static_vector<Vertex_handle, max_dimension_ + 1> Simplex_vertex_range;
+  typedef boost::iterator_range<typename std::vector<Simplex_handle>::const_iterator> Skeleton_simplex_range;
+
+  /** \brief Streamed_flag_complex constructor from a graph.
+   *
+   * @param[in] skel_graph The 1-skeleton, as accepted by the constructor of `Flag_complex_stream`.
+   * @param[in] max_dim Maximal dimension of the simplices, at most 14.
+   * @exception std::invalid_argument If max_dim is larger than 14.
+   * @exception std::out_of_range If the complex cannot be encoded, see above, or if it has more simplices than
+   * `SimplexKey` can count.
+   */
+  template<class OneSkeletonGraph>
+  Streamed_flag_complex(const OneSkeletonGraph& skel_graph, int max_dim)
+      : Streamed_flag_complex(Flag_complex_stream<Filtration_value>(skel_graph, max_dim)) { }
+
+  /** \brief Streamed_flag_complex constructor from a stream, that is only used during the construction.
+   *
+   * @exception std::invalid_argument If the maximal dimension of the stream is larger than 14.
+   * @exception std::out_of_range If the complex cannot be encoded, see above, or if it has more simplices than
+   * `SimplexKey` can count.
+   */
+  explicit Streamed_flag_complex(const Flag_complex_stream<Filtration_value>& stream) : dimension_(-1) {
+    if (stream.max_dimension() > max_dimension_)
+      throw std::invalid_argument("Streamed_flag_complex - the dimension is limited to 14");
+    compute_binomials(stream.num_vertices(), stream.max_dimension() < 0 ? 0 : stream.max_dimension() + 1);
+
+    // A first pass counts the simplices to allocate exactly what is needed.
+    std::size_t num_simplices = 0;
+    stream.for_each_simplex([&](const std::vector<Vertex_handle>&, const Filtration_value&) { ++num_simplices; });
+    if (num_simplices >= static_cast<std::size_t>(null_key()))
+      throw std::out_of_range("Streamed_flag_complex - the number of simplices is more than Simplex_key can count");
+    codes_.reserve(num_simplices);
+    vertices_.reserve(stream.num_vertices());
+
+    Simplex_vertex_range sorted_simplex;
+    stream.for_each_simplex([&](const std::vector<Vertex_handle>& simplex, const Filtration_value& filt) {
+      sorted_simplex.assign(simplex.begin(), simplex.end());
+      std::sort(sorted_simplex.begin(), sorted_simplex.end());
+      int dim = static_cast<int>(simplex.size()) - 1;
+      std::uint64_t code = encode(sorted_simplex.begin(), sorted_simplex.end());
+      if (code >= max_code_)
+        throw std::out_of_range("Streamed_flag_complex - too many vertices to encode the simplices");
+      Simplex_key key = static_cast<Simplex_key>(codes_.size());
+      if (filtration_values_.empty() || filtration_values_.back().second != filt)
+        filtration_values_.emplace_back(key, filt);
+      if (dim == 0) vertices_.push_back(key);
+      if (dim > dimension_) dimension_ = dim;
+      codes_.push_back((static_cast<std::uint64_t>(dim) << code_bits_) | code);
+    });
+
+    keys_by_code_.resize(codes_.size());
+    std::iota(keys_by_code_.begin(), keys_by_code_.end(), 0);
+    auto by_code = [this](Simplex_key a, Simplex_key b) { return codes_[a] < codes_[b]; };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_sort(keys_by_code_.begin(), keys_by_code_.end(), by_code);
+#else
+    std::sort(keys_by_code_.begin(), keys_by_code_.end(), by_code);
+#endif
+
+    // The simplices of dimension dim whose largest vertex is v have the codes in
+    // [binomial(v, dim + 1), binomial(v + 1, dim + 1)).
+    bucket_starts_.assign(dimension_ + 1, std::vector<Simplex_key>(stream.num_vertices() + 1));
+    std::size_t pos = 0;
+    for (int dim = 0; dim <= dimension_; ++dim) {
+      for (std::size_t v = 0; v <= stream.num_vertices(); ++v) {
+        std::uint64_t first_code = (static_cast<std::uint64_t>(dim) << code_bits_) | binomials_[dim + 1][v];
+        while (pos < keys_by_code_.size() && codes_[keys_by_code_[pos]] < first_code) ++pos;
+        bucket_starts_[dim][v] = static_cast<Simplex_key>(pos);
+      }
+    }
+  }
+
+  /** \brief Returns the number of simplices. */
+  std::size_t num_simplices() const {
+    return codes_.size();
+  }
+
+  /** \brief Returns the number of vertices. */
+  std::size_t num_vertices() const {
+    return vertices_.size();
+  }
+
+  /** \brief Returns the dimension of the complex. */
+  int dimension() const {
+    return dimension_;
+  }
+
+  /** \brief Returns the dimension of a simplex. */
+  int dimension(Simplex_handle sh) const {
+    return static_cast<int>(codes_[sh] >> code_bits_);
+  }
+
+  /** \brief Returns the filtration value of a simplex.
+   *
+   * Called on the null_simplex, it returns infinity. */
+  Filtration_value filtration(Simplex_handle sh) const {
+    if (sh == null_simplex()) {
+      return std::numeric_limits<Filtration_value>::infinity();
+    }
+    auto next = std::upper_bound(filtration_values_.begin(), filtration_values_.end(), sh,
+                                 [](Simplex_key k, const std::pair<Simplex_key, Filtration_value>& first_with_value) {
+                                   return k < first_with_value.first;
+                                 });
+    return std::prev(next)->second;
+  }
+
+  /** \brief Returns the key of a simplex, that is its position in the filtration. */
+  Simplex_key key(Simplex_handle sh) const {
+    return sh;
+  }
+
+  /** \brief The keys cannot be chosen, they must be the positions in the filtration, as assigned by
+   * `Persistent_cohomology`. */
+  void assign_key(Simplex_handle GUDHI_CHECK_code(sh), Simplex_key GUDHI_CHECK_code(key)) {
+    GUDHI_CHECK(key == sh, std::invalid_argument("Streamed_flag_complex::assign_key - the key must be the position "
+                                                 "of the simplex in the filtration"));
+  }
+
+  static Simplex_key null_key() {
+    return static_cast<Simplex_key>(-1);
+  }
+
+  static Simplex_handle null_simplex() {
+    return static_cast<Simplex_handle>(-1);
+  }
+
+  /** \brief Returns the simplex at position idx in the filtration. */
+  Simplex_handle simplex(Simplex_key idx) const {
+    return idx;
+  }
+
+  /** \brief The simplices are stored in filtration order, there is nothing to do. */
+  void initialize_filtration() const { }
+
+  Filtration_simplex_range filtration_simplex_range() const {
+    return Filtration_simplex_range(Filtration_simplex_iterator(0),
+                                    Filtration_simplex_iterator(static_cast<Simplex_handle>(codes_.size())));
+  }
+
+  /** \brief Returns the vertices of a simplex, in increasing order. */
+  Simplex_vertex_range simplex_vertex_range(Simplex_handle sh) const {
+    Vertex_handle vertices[max_dimension_ + 1];
+    int dim = decode(sh, vertices);
+    return Simplex_vertex_range(vertices, vertices + dim + 1);
+  }
+
+  /** \brief Returns the facets of a simplex \f$[v_0, \cdots ,v_d]\f$, with \f$v_0 < \cdots < v_d\f$, in the order
+   * \f$[v_0,\cdots,\widehat{v_i},\cdots,v_d]\f$ for \f$i\f$ from 0 to d, empty for a vertex. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) const {
+    Boundary_simplex_range facets;
+    Vertex_handle vertices[max_dimension_ + 1];
+    int dim = decode(sh, vertices);
+    if (dim == 0) return facets;
+    // The vertices after the removed one move down by one rank in the encoding.
+    std::uint64_t after = 0;
+    for (int j = 1; j <= dim; ++j)
+      after += binomials_[j][vertices[j]];
+    // The largest vertex of all the facets but the last one
+    const Vertex_handle last_vertex = vertices[dim];
+    std::uint64_t before = 0;
+    for (int i = 0; i < dim; ++i) {
+      facets.push_back(find(dim - 1, last_vertex, before + after));
+      before += binomials_[i + 1][vertices[i]];
+      after -= binomials_[i + 1][vertices[i + 1]];
+    }
+    facets.push_back(find(dim - 1, vertices[dim - 1], before));
+    return facets;
+  }
+
+  /** \brief Returns a range over the vertices of the complex, in filtration order. Only the 0-skeleton is
+   * available. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim = 0) const {
+    if (dim != 0) {
+      std::cerr << "Streamed_flag_complex::skeleton_simplex_range - dimension must be 0\n";
+    }
+    return Skeleton_simplex_range(vertices_.begin(), vertices_.end());
+  }
+
+  /** \brief Returns the two vertices of an edge. */
+  std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) const {
+    GUDHI_CHECK(dimension(sh) == 1, std::invalid_argument("Streamed_flag_complex::endpoints - not an edge"));
+    Vertex_handle vertices[2];
+    decode(sh, vertices);
+    return std::pair<Simplex_handle, Simplex_handle>(keys_by_code_[bucket_starts_[0][vertices[0]]],
+                                                     keys_by_code_[bucket_starts_[0][vertices[1]]]);
+  }
+
+ private:
+  // A simplex v_0 < ... < v_d is encoded as the sum of binomial(v_i, i + 1), which is smaller than max_code_, and
+  // its dimension is stored in the upper bits.
+  static const int code_bits_ = 60;
+  static constexpr std::uint64_t max_code_ = std::uint64_t(1) << code_bits_;
+
+  void compute_binomials(std::size_t num_vertices, int max_k) {
+    // binomials_[k][n] is binomial(n, k), capped to max_code_ which is larger than any valid code.
+    binomials_.assign(max_k + 1, std::vector<std::uint64_t>(num_vertices + 1, 0));
+    for (std::size_t n = 0; n <= num_vertices; ++n) {
+      binomials_[0][n] = 1;
+      for (int k = 1; k <= max_k && static_cast<std::size_t>(k) <= n; ++k)
+        binomials_[k][n] = std::min(max_code_, binomials_[k - 1][n - 1] + binomials_[k][n - 1]);
+    }
+  }
+
+  // Writes the vertices of a simplex in increasing order, and returns its dimension.
+  int decode(Simplex_handle sh, Vertex_handle* vertices) const {
+    int dim = dimension(sh);
+    std::uint64_t code = codes_[sh] & (max_code_ - 1);
+    // The largest vertex v such that binomial(v, k) <= code is the k-th vertex.
+    auto upper = binomials_[dim + 1].end();
+    for (int k = dim + 1; k > 0; --k) {
+      auto next = std::upper_bound(binomials_[k].begin(), upper, code);
+      Vertex_handle vertex = static_cast<Vertex_handle>(next - binomials_[k].begin()) - 1;
+      vertices[k - 1] = vertex;
+      code -= binomials_[k][vertex];
+      upper = binomials_[k - 1].begin() + vertex;
+    }
+    return dim;
+  }
+
+  template<class Iterator>
+  std::uint64_t encode(Iterator first, Iterator last) const {
+    std::uint64_t code = 0;
+    for (int k = 1; first != last; ++first, ++k)
+      code += binomials_[k][*first];
+    return code;
+  }
+
+  // Returns the simplex of dimension dim, largest vertex last_vertex and given code, without the dimension bits.
+  Simplex_handle find(int dim, Vertex_handle last_vertex, std::uint64_t code) const {
+    code |= static_cast<std::uint64_t>(dim) << code_bits_;
+    auto bucket_end = keys_by_code_.begin() + bucket_starts_[dim][last_vertex + 1];
+    auto it = std::lower_bound(keys_by_code_.begin() + bucket_starts_[dim][last_vertex], bucket_end, code,
+                               [this](Simplex_key k, std::uint64_t c) { return codes_[k] < c; });
+    GUDHI_CHECK(it != bucket_end && codes_[*it] == code,
+                std::logic_error("Streamed_flag_complex - a face is missing"));
+    return *it;
+  }
+
+  // Code of each simplex, in filtration order
+  std::vector<std::uint64_t> codes_;
+  // All the keys, sorted by code
+  std::vector<Simplex_key> keys_by_code_;
+  // Position in keys_by_code_ of the first simplex of each dimension with each largest vertex
+  std::vector<std::vector<Simplex_key>> bucket_starts_;
+  // First key with each filtration value
+  std::vector<std::pair<Simplex_key, Filtration_value>> filtration_values_;
+  std::vector<Simplex_handle> vertices_;
+  std::vector<std::vector<std::uint64_t>> binomials_;
+  int dimension_;
+};
+
+template<typename FiltrationValue, typename SimplexKey>
+constexpr std::uint64_t Streamed_flag_complex<FiltrationValue, SimplexKey>::max_code_;
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // STREAMED_FLAG_COMPLEX_H_
@@ -17,6 +17,10 @@
 #include <string>
 #include <vector>
 #include <algorithm>    // std::max
+#include <map>
+#include <random>
+#include <set>
+#include <tuple>
 
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
@@ -26,6 +30,11 @@
 #include <gudhi/distance_functions.h>
 #include <gudhi/reader_utils.h>
 #include <gudhi/Unitary_tests_utils.h>
+#include <gudhi/Flag_complex_stream.h>
+#include <gudhi/Streamed_flag_complex.h>
+#include <gudhi/Flag_complex_size_estimator.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Rips_persistence.h>
 
 // Type definitions
 using Point = std::vector<double>;
@@ -380,6 +389,285 @@ BOOST_AUTO_TEST_CASE(Rips_doc_csv_file) {
 
 }
 
+BOOST_AUTO_TEST_CASE(Flag_complex_stream_order) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points(40);
+  for (auto& point : points) point = {coord(gen), coord(gen), coord(gen)};
+
+  Rips_complex rips_complex(points, 0.5, Gudhi::Euclidean_distance());
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, 4);
+
+  Gudhi::Proximity_graph<Simplex_tree> graph = Gudhi::compute_proximity_graph<Simplex_tree>(
+      points, 0.5, Gudhi::Euclidean_distance());
+  Gudhi::rips_complex::Flag_complex_stream<Filtration_value> stream(graph, 4);
+  BOOST_CHECK(stream.num_vertices() == stree.num_vertices());
+  std::size_t num_edges = 0;
+  for (auto sh : stree.skeleton_simplex_range(1))
+    if (stree.dimension(sh) == 1) ++num_edges;
+  BOOST_CHECK(stream.num_edges() == num_edges);
+
+  std::set<std::vector<int>> visited;
+  Filtration_value previous = -std::numeric_limits<Filtration_value>::infinity();
+  stream.for_each_simplex([&](const std::vector<int>& vertices, Filtration_value filt) {
+    std::vector<int> simplex(vertices);
+    std::sort(simplex.begin(), simplex.end());
+    BOOST_CHECK(previous <= filt);
+    previous = filt;
+    auto sh = stree.find(simplex);
+    BOOST_REQUIRE(sh != stree.null_simplex());
+    BOOST_CHECK(stree.filtration(sh) == filt);
+    // Faces are visited before cofaces
+    if (simplex.size() > 1) {
+      for (std::size_t i = 0; i < simplex.size(); ++i) {
+        std::vector<int> facet(simplex);
+        facet.erase(facet.begin() + i);
+        BOOST_CHECK(visited.count(facet) == 1);
+      }
+    }
+    BOOST_CHECK(visited.insert(simplex).second);
+  });
+  BOOST_CHECK(visited.size() == stree.num_simplices());
+}
+
+BOOST_AUTO_TEST_CASE(Streamed_flag_complex_persistence) {
+  using Streamed_flag_complex = Gudhi::rips_complex::Streamed_flag_complex<Filtration_value>;
+  using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points(60);
+  for (auto& point : points) point = {coord(gen), coord(gen)};
+
+  Rips_complex rips_complex(points, 0.4, Gudhi::Euclidean_distance());
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, 3);
+  Streamed_flag_complex streamed = rips_complex.create_streamed_complex(3);
+
+  BOOST_CHECK(streamed.num_simplices() == stree.num_simplices());
+  BOOST_CHECK(streamed.num_vertices() == stree.num_vertices());
+  BOOST_CHECK(streamed.dimension() == stree.dimension());
+  for (auto sh : streamed.filtration_simplex_range()) {
+    auto vertices = streamed.simplex_vertex_range(sh);
+    std::vector<int> simplex(vertices.begin(), vertices.end());
+    BOOST_CHECK(static_cast<int>(simplex.size()) == streamed.dimension(sh) + 1);
+    BOOST_CHECK(std::is_sorted(simplex.begin(), simplex.end()));
+    auto st_sh = stree.find(simplex);
+    BOOST_REQUIRE(st_sh != stree.null_simplex());
+    BOOST_CHECK(stree.filtration(st_sh) == streamed.filtration(sh));
+    if (sh > 0) BOOST_CHECK(streamed.filtration(sh - 1) <= streamed.filtration(sh));
+    for (auto facet : streamed.boundary_simplex_range(sh)) {
+      BOOST_CHECK(facet < sh);
+      BOOST_CHECK(streamed.dimension(facet) + 1 == streamed.dimension(sh));
+    }
+  }
+
+  Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp> st_pcoh(stree);
+  st_pcoh.init_coefficients(2);
+  st_pcoh.compute_persistent_cohomology();
+  Gudhi::persistent_cohomology::Persistent_cohomology<Streamed_flag_complex, Field_Zp> streamed_pcoh(streamed);
+  streamed_pcoh.init_coefficients(2);
+  streamed_pcoh.compute_persistent_cohomology();
+
+  std::multiset<std::tuple<int, Filtration_value, Filtration_value>> st_diagram, streamed_diagram;
+  for (auto& pair : st_pcoh.get_persistent_pairs())
+    st_diagram.emplace(stree.dimension(std::get<0>(pair)), stree.filtration(std::get<0>(pair)),
+                       stree.filtration(std::get<1>(pair)));
+  for (auto& pair : streamed_pcoh.get_persistent_pairs())
+    streamed_diagram.emplace(streamed.dimension(std::get<0>(pair)), streamed.filtration(std::get<0>(pair)),
+                             streamed.filtration(std::get<1>(pair)));
+  std::cout << "Number of persistent pairs = " << st_diagram.size() << std::endl;
+  BOOST_CHECK(st_diagram == streamed_diagram);
+}
+
+BOOST_AUTO_TEST_CASE(Streamed_flag_complex_throw) {
+  using Streamed_flag_complex = Gudhi::rips_complex::Streamed_flag_complex<Filtration_value>;
+  std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 1}};
+  std::vector<Filtration_value> edges_fil = {1., 2.};
+  Gudhi::Proximity_graph<Simplex_tree> graph_with_loop(edges.begin(), edges.end(), edges_fil.begin(), 2);
+  BOOST_CHECK_THROW(Streamed_flag_complex(graph_with_loop, 2), std::invalid_argument);
+
+  edges.pop_back();
+  edges_fil.pop_back();
+  Gudhi::Proximity_graph<Simplex_tree> graph(edges.begin(), edges.end(), edges_fil.begin(), 2);
+  BOOST_CHECK_THROW(Streamed_flag_complex(graph, 15), std::invalid_argument);
+  Streamed_flag_complex streamed(graph, 14);
+  BOOST_CHECK(streamed.num_simplices() == 3);
+  BOOST_CHECK(streamed.dimension() == 1);
+}
+
+template<class CoefficientField>
+void check_rips_persistence(Rips_complex& rips_complex, Simplex_tree& stree, int dim_max, int p,
+                            Filtration_value min_persistence) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, CoefficientField> st_pcoh(stree);
+  st_pcoh.init_coefficients(p);
+  st_pcoh.compute_persistent_cohomology(min_persistence);
+  auto rips_pers = rips_complex.template create_persistence<CoefficientField>(dim_max);
+  rips_pers.init_coefficients(p);
+  rips_pers.compute_persistent_cohomology(min_persistence);
+
+  std::multiset<std::tuple<int, Filtration_value, Filtration_value>> st_diagram, rips_diagram;
+  for (auto& pair : st_pcoh.get_persistent_pairs())
+    st_diagram.emplace(stree.dimension(std::get<0>(pair)), stree.filtration(std::get<0>(pair)),
+                       stree.filtration(std::get<1>(pair)));
+  for (auto& pair : rips_pers.get_persistent_pairs()) rips_diagram.insert(pair);
+  BOOST_CHECK(st_diagram == rips_diagram);
+  BOOST_CHECK(rips_pers.betti_numbers() == st_pcoh.betti_numbers());
+  for (int dim = 0; dim < dim_max; ++dim) {
+    auto intervals = rips_pers.intervals_in_dimension(dim);
+    auto reference = st_pcoh.intervals_in_dimension(dim);
+    std::sort(intervals.begin(), intervals.end());
+    std::sort(reference.begin(), reference.end());
+    BOOST_CHECK(intervals == reference);
+
+    // The same intervals passed to a sink that only receives this dimension
+    decltype(reference) streamed;
+    auto rips_streamed = rips_complex.template create_persistence<CoefficientField>(dim_max);
+    rips_streamed.init_coefficients(p);
+    rips_streamed.compute_persistent_cohomology(min_persistence, [&](const auto& pair) {
+      BOOST_CHECK(std::get<0>(pair) == dim);
+      streamed.emplace_back(std::get<1>(pair), std::get<2>(pair));
+    }, dim);
+    std::sort(streamed.begin(), streamed.end());
+    BOOST_CHECK(streamed == reference);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_same_diagram) {
+  using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+  using Field_Z2 = Gudhi::persistent_cohomology::Field_Z2;
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points(70);
+  for (auto& point : points) point = {coord(gen), coord(gen), coord(gen)};
+  Distance_matrix distances(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    for (std::size_t j = 0; j < i; ++j) distances[i].push_back(Gudhi::Euclidean_distance()(points[i], points[j]));
+
+  // With dim_max 0, the complex still has its edges
+  for (int dim_max : {0, 1, 2, 3}) {
+    Rips_complex from_points(points, 0.45, Gudhi::Euclidean_distance());
+    Rips_complex from_matrix(distances, 0.45);
+    Simplex_tree stree;
+    from_points.create_complex(stree, dim_max);
+    stree.initialize_filtration();
+    for (Rips_complex* rips_complex : {&from_points, &from_matrix}) {
+      check_rips_persistence<Field_Zp>(*rips_complex, stree, dim_max, 2, 0.);
+      check_rips_persistence<Field_Zp>(*rips_complex, stree, dim_max, 3, 0.05);
+      check_rips_persistence<Field_Z2>(*rips_complex, stree, dim_max, 2, 0.);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_throw) {
+  using Rips_persistence = Gudhi::rips_complex::Rips_persistence<Filtration_value>;
+  std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 1}};
+  std::vector<Filtration_value> edges_fil = {1., 2.};
+  Gudhi::Proximity_graph<Simplex_tree> graph_with_loop(edges.begin(), edges.end(), edges_fil.begin(), 2);
+  BOOST_CHECK_THROW(Rips_persistence(graph_with_loop, 2), std::invalid_argument);
+
+  // binomial(2^20, 4) is larger than 2^63, binomial(2^20, 3) is not
+  Gudhi::Proximity_graph<Simplex_tree> no_edges(1 << 20);
+  BOOST_CHECK_THROW(Rips_persistence(no_edges, 3), std::out_of_range);
+  Rips_persistence rips_pers(no_edges, 2);
+}
+
+// Number of simplices of each dimension, and number of them with children
+std::pair<std::vector<std::size_t>, std::vector<std::size_t>> simplex_tree_counts(Simplex_tree& stree, int max_dim) {
+  std::vector<std::size_t> num_simplices(max_dim + 1, 0), num_parents(max_dim + 1, 0);
+  for (auto sh : stree.complex_simplex_range()) {
+    ++num_simplices[stree.dimension(sh)];
+    if (stree.has_children(sh)) ++num_parents[stree.dimension(sh)];
+  }
+  return std::make_pair(num_simplices, num_parents);
+}
+
+BOOST_AUTO_TEST_CASE(Flag_complex_size_estimator_counts) {
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  // Large enough neighborhoods to need several words in the bitsets
+  for (auto test : {std::make_tuple(400, 0.25, 2), std::make_tuple(100, 0.3, 3), std::make_tuple(60, 0.5, 5)}) {
+    std::vector<Point> points(std::get<0>(test));
+    for (auto& point : points) point = {coord(gen), coord(gen)};
+    Rips_complex rips_complex(points, std::get<1>(test), Gudhi::Euclidean_distance());
+
+    for (int max_dim = 1; max_dim <= std::get<2>(test); ++max_dim) {
+      auto estimator = rips_complex.create_size_estimator(max_dim);
+      BOOST_CHECK(estimator.max_dimension() == max_dim);
+      for (double threshold : {0., 0.1, 0.2, std::get<1>(test)}) {
+        Rips_complex lower_rips(points, threshold, Gudhi::Euclidean_distance());
+        Simplex_tree stree;
+        lower_rips.create_complex(stree, max_dim);
+        auto counts = simplex_tree_counts(stree, max_dim);
+        auto size = threshold == std::get<1>(test) ? estimator.count_simplices() : estimator.count_simplices(threshold);
+        std::cout << "Flag_complex_size_estimator - " << points.size() << " points - threshold " << threshold
+                  << " - dimension " << max_dim << " - " << size.total() << " simplices" << std::endl;
+        BOOST_CHECK(size.complete);
+        BOOST_CHECK(size.num_simplices == counts.first);
+        BOOST_CHECK(size.num_parents == counts.second);
+        BOOST_CHECK(size.total() == stree.num_simplices());
+
+        // Only the memory allocated beyond the size of the dictionaries is not predicted
+        stree.initialize_filtration();
+        auto usage = stree.memory_usage();
+        std::size_t unused_capacity = 0;
+        for (std::size_t unused : usage.unused_capacity) unused_capacity += unused;
+        BOOST_CHECK(Gudhi::rips_complex::estimated_memory_usage<Simplex_tree>(size) ==
+                    usage.total() - unused_capacity);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_create_complex_with_memory_budget) {
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points(80);
+  for (auto& point : points) point = {coord(gen), coord(gen), coord(gen)};
+  Rips_complex rips_complex(points, 0.6, Gudhi::Euclidean_distance());
+  const int max_dim = 4;
+
+  Simplex_tree full;
+  rips_complex.create_complex(full, max_dim);
+  std::size_t full_bytes = Gudhi::rips_complex::estimated_memory_usage<Simplex_tree>(
+      rips_complex.create_size_estimator(max_dim).count_simplices());
+
+  // The whole complex fits
+  Simplex_tree stree;
+  Filtration_value threshold = rips_complex.create_complex(stree, max_dim, full_bytes);
+  BOOST_CHECK(stree == full);
+  Filtration_value longest = 0.;
+  for (auto sh : full.complex_simplex_range()) longest = std::max(longest, full.filtration(sh));
+  BOOST_CHECK(threshold == longest);
+
+  for (std::size_t max_bytes : {full_bytes - 1, full_bytes / 3, full_bytes / 100}) {
+    Simplex_tree lowered;
+    threshold = rips_complex.create_complex(lowered, max_dim, max_bytes);
+    auto lowered_size = Gudhi::rips_complex::Flag_complex_size_estimator<Filtration_value>(
+        Gudhi::compute_proximity_graph<Simplex_tree>(points, threshold, Gudhi::Euclidean_distance()), max_dim)
+            .count_simplices();
+    std::cout << "Rips_create_complex_with_memory_budget - " << max_bytes << " bytes - threshold " << threshold
+              << " - " << lowered.num_simplices() << " simplices" << std::endl;
+    BOOST_CHECK(lowered.num_simplices() == lowered_size.total());
+    BOOST_CHECK(Gudhi::rips_complex::estimated_memory_usage<Simplex_tree>(lowered_size) <= max_bytes);
+    BOOST_CHECK(threshold < longest);
+    BOOST_CHECK(lowered.num_vertices() == full.num_vertices());
+    // The complex is the Rips complex of the lowered threshold, which is the largest one that fits
+    for (auto sh : lowered.complex_simplex_range()) {
+      BOOST_CHECK(lowered.filtration(sh) <= threshold);
+      BOOST_CHECK(full.filtration(full.find(lowered.simplex_vertex_range(sh))) == lowered.filtration(sh));
+    }
+    Filtration_value next = longest;
+    for (auto sh : full.skeleton_simplex_range(1))
+      if (full.filtration(sh) > threshold) next = std::min(next, full.filtration(sh));
+    auto next_size = rips_complex.create_size_estimator(max_dim).count_simplices(next);
+    BOOST_CHECK(Gudhi::rips_complex::estimated_memory_usage<Simplex_tree>(next_size) > max_bytes);
+  }
+
+  Simplex_tree empty;
+  BOOST_CHECK_THROW(rips_complex.create_complex(empty, max_dim, 10), std::out_of_range);
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Rips_create_complex_throw) {
   // ----------------------------------------------------------------------------
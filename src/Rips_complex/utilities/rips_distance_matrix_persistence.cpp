@@ -9,6 +9,7 @@
  */
 
 #include <gudhi/Rips_complex.h>
+#include <gudhi/Rips_persistence.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
 #include <gudhi/reader_utils.h>
@@ -18,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <limits>  // infinity
+#include <stdexcept>  // for std::invalid_argument
 
 // Types definition
 using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
@@ -28,7 +30,25 @@ using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomolog
 using Distance_matrix = std::vector<std::vector<Filtration_value>>;
 
 void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence);
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     std::string& algorithm);
+
+// Compute the persistence diagram of the complex and output it in filediag
+template<class Persistence>
+void output_persistence(Persistence& pcoh, int p, Filtration_value min_persistence, const std::string& filediag) {
+  // initializes the coefficient field for homology
+  pcoh.init_coefficients(p);
+
+  // Output the diagram in filediag, each interval as soon as it is computed
+  std::ofstream out;
+  if (!filediag.empty()) {
+    out.open(filediag);
+  }
+  std::ostream& diagram = filediag.empty() ? std::cout : out;
+  pcoh.compute_persistent_cohomology(min_persistence, [&](const auto& interval) {
+    pcoh.output_interval(diagram, interval);
+  });
+}
 
 int main(int argc, char* argv[]) {
   std::string csv_matrix_file;
@@ -37,12 +57,21 @@ int main(int argc, char* argv[]) {
   int dim_max;
   int p;
   Filtration_value min_persistence;
+  std::string algorithm;
 
-  program_options(argc, argv, csv_matrix_file, filediag, threshold, dim_max, p, min_persistence);
+  program_options(argc, argv, csv_matrix_file, filediag, threshold, dim_max, p, min_persistence, algorithm);
 
   Distance_matrix distances = Gudhi::read_lower_triangular_matrix_from_csv_file<Filtration_value>(csv_matrix_file);
   Rips_complex rips_complex_from_file(distances, threshold);
 
+  if (algorithm == "implicit") {
+    // Compute the persistence from the Rips graph, without any Simplex Tree
+    auto pcoh = rips_complex_from_file.create_persistence(dim_max);
+    output_persistence(pcoh, p, min_persistence, filediag);
+    return 0;
+  }
+  if (algorithm != "cam") throw std::invalid_argument("Unknown persistence algorithm " + algorithm);
+
   // Construct the Rips complex in a Simplex Tree
   Simplex_tree simplex_tree;
 
@@ -53,26 +82,14 @@ int main(int argc, char* argv[]) {
   // Sort the simplices in the order of the filtration
   simplex_tree.initialize_filtration();
 
-  // Compute the persistence diagram of the complex
   Persistent_cohomology pcoh(simplex_tree);
-  // initializes the coefficient field for homology
-  pcoh.init_coefficients(p);
-
-  pcoh.compute_persistent_cohomology(min_persistence);
-
-  // Output the diagram in filediag
-  if (filediag.empty()) {
-    pcoh.output_diagram();
-  } else {
-    std::ofstream out(filediag);
-    pcoh.output_diagram(out);
-    out.close();
-  }
+  output_persistence(pcoh, p, min_persistence, filediag);
   return 0;
 }
 
 void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence) {
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     std::string& algorithm) {
   namespace po = boost::program_options;
   po::options_description hidden("Hidden options");
   hidden.add_options()(
@@ -92,7 +109,10 @@ void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::
       "Characteristic p of the coefficient field Z/pZ for computing homology.")(
       "min-persistence,m", po::value<Filtration_value>(&min_persistence),
       "Minimal lifetime of homology feature to be recorded. Default is 0. Enter a negative value to see zero length "
-      "intervals");
+      "intervals")(
+      "algorithm,a", po::value<std::string>(&algorithm)->default_value("cam"),
+      "Persistence algorithm: cam for the compressed annotation matrix, or implicit to reduce the coboundaries of "
+      "the Rips complex without building it.");
 
   po::positional_options_description pos;
   pos.add("input-file", 1);
@@ -9,9 +9,11 @@
  */
 
 #include <gudhi/Rips_complex.h>
+#include <gudhi/Rips_persistence.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Boundary_matrix_reduction.h>
 #include <gudhi/Points_off_io.h>
 
 #include <boost/program_options.hpp>
@@ -19,6 +21,8 @@
 #include <string>
 #include <vector>
 #include <limits>  // infinity
+#include <cstddef>  // for std::size_t
+#include <stdexcept>  // for std::invalid_argument
 
 // Types definition
 using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
@@ -26,11 +30,31 @@ using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
 using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
 using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
+using Boundary_matrix_reduction = Gudhi::persistent_cohomology::Boundary_matrix_reduction<Simplex_tree, Field_Zp>;
+using Reduction_algorithm = Gudhi::persistent_cohomology::Reduction_algorithm;
 using Point = std::vector<double>;
 using Points_off_reader = Gudhi::Points_off_reader<Point>;
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence);
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     std::size_t& max_memory, std::string& algorithm);
+
+// Compute the persistence diagram of the complex and output it in filediag
+template<class Persistence>
+void output_persistence(Persistence& pcoh, int p, Filtration_value min_persistence, const std::string& filediag) {
+  // initializes the coefficient field for homology
+  pcoh.init_coefficients(p);
+
+  // Output the diagram in filediag, each interval as soon as it is computed
+  std::ofstream out;
+  if (!filediag.empty()) {
+    out.open(filediag);
+  }
+  std::ostream& diagram = filediag.empty() ? std::cout : out;
+  pcoh.compute_persistent_cohomology(min_persistence, [&](const auto& interval) {
+    pcoh.output_interval(diagram, interval);
+  });
+}
 
 int main(int argc, char* argv[]) {
   std::string off_file_points;
@@ -39,43 +63,63 @@ int main(int argc, char* argv[]) {
   int dim_max;
   int p;
   Filtration_value min_persistence;
+  std::size_t max_memory;
+  std::string algorithm;
 
-  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence);
+  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence, max_memory,
+                  algorithm);
 
   Points_off_reader off_reader(off_file_points);
   Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
 
+  if (algorithm == "implicit") {
+    // Compute the persistence from the Rips graph, without any Simplex Tree
+    auto pcoh = rips_complex_from_file.create_persistence(dim_max);
+    output_persistence(pcoh, p, min_persistence, filediag);
+    return 0;
+  }
+
   // Construct the Rips complex in a Simplex Tree
   Simplex_tree simplex_tree;
 
-  rips_complex_from_file.create_complex(simplex_tree, dim_max);
+  if (max_memory == 0) {
+    rips_complex_from_file.create_complex(simplex_tree, dim_max);
+  } else {
+    // Lower the threshold so that the complex fits in max_memory MB
+    threshold = rips_complex_from_file.create_complex(simplex_tree, dim_max, max_memory << 20);
+    std::cout << "The maximal edge length is " << threshold << " to fit in " << max_memory << " MB \n";
+  }
   std::cout << "The complex contains " << simplex_tree.num_simplices() << " simplices \n";
   std::cout << "   and has dimension " << simplex_tree.dimension() << " \n";
 
   // Sort the simplices in the order of the filtration
   simplex_tree.initialize_filtration();
 
-  // Compute the persistence diagram of the complex
-  Persistent_cohomology pcoh(simplex_tree);
-  // initializes the coefficient field for homology
-  pcoh.init_coefficients(p);
-
-  pcoh.compute_persistent_cohomology(min_persistence);
-
-  // Output the diagram in filediag
-  if (filediag.empty()) {
-    pcoh.output_diagram();
+  if (algorithm == "cam") {
+    Persistent_cohomology pcoh(simplex_tree);
+    output_persistence(pcoh, p, min_persistence, filediag);
   } else {
-    std::ofstream out(filediag);
-    pcoh.output_diagram(out);
-    out.close();
+    Reduction_algorithm reduction_algorithm;
+    if (algorithm == "cohomology")
+      reduction_algorithm = Reduction_algorithm::cohomology;
+    else if (algorithm == "twist")
+      reduction_algorithm = Reduction_algorithm::twist;
+    else if (algorithm == "standard")
+      reduction_algorithm = Reduction_algorithm::standard;
+    else if (algorithm == "chunk")
+      reduction_algorithm = Reduction_algorithm::chunk;
+    else
+      throw std::invalid_argument("Unknown persistence algorithm " + algorithm);
+    Boundary_matrix_reduction pcoh(simplex_tree, false, reduction_algorithm);
+    output_persistence(pcoh, p, min_persistence, filediag);
   }
 
   return 0;
 }
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence) {
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     std::size_t& max_memory, std::string& algorithm) {
   namespace po = boost::program_options;
   po::options_description hidden("Hidden options");
   hidden.add_options()("input-file", po::value<std::string>(&off_file_points),
@@ -94,7 +138,14 @@ void program_options(int argc, char* argv[], std::string& off_file_points, std::
       "Characteristic p of the coefficient field Z/pZ for computing homology.")(
       "min-persistence,m", po::value<Filtration_value>(&min_persistence),
       "Minimal lifetime of homology feature to be recorded. Default is 0. Enter a negative value to see zero length "
-      "intervals");
+      "intervals")(
+      "max-memory,M", po::value<std::size_t>(&max_memory)->default_value(0),
+      "Memory budget of the Rips complex, in MB. The maximal edge length is lowered until the predicted memory of the "
+      "complex fits. Default is 0, no budget.")(
+      "algorithm,a", po::value<std::string>(&algorithm)->default_value("cam"),
+      "Persistence algorithm: cam for the compressed annotation matrix, cohomology, twist or standard for a "
+      "reduction of the boundary matrix, chunk for its parallel reduction, or implicit to reduce the coboundaries "
+      "of the Rips complex without building it. The memory budget does not apply to implicit.");
 
   po::positional_options_description pos;
   pos.add("input-file", 1);
@@ -0,0 +1,79 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cmath>  // for std::floor
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Filtration_value = Simplex_tree::Filtration_value;
+
+/* Flag complex of random points in the unit square, with the edge lengths rounded to num_values levels. */
+Simplex_tree quantized_flag_complex(int num_points, double threshold, int num_values, int max_dim) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < num_points; ++i)
+    points.emplace_back(coord(gen), coord(gen));
+
+  Simplex_tree st;
+  for (int i = 0; i < num_points; ++i)
+    st.insert_simplex({i}, 0.);
+  for (int i = 0; i < num_points; ++i) {
+    for (int j = i + 1; j < num_points; ++j) {
+      double dx = points[i].first - points[j].first;
+      double dy = points[i].second - points[j].second;
+      double d = std::sqrt(dx * dx + dy * dy);
+      if (d <= threshold) {
+        Filtration_value f = num_values > 0 ? std::floor(d / threshold * num_values) : d;
+        st.insert_simplex({i, j}, f);
+      }
+    }
+  }
+  st.expansion(max_dim);
+  return st;
+}
+
+int main(int argc, char* argv[]) {
+  int num_points = argc > 1 ? std::stoi(argv[1]) : 2000;
+  double threshold = argc > 2 ? std::stod(argv[2]) : 0.06;
+  int max_dim = argc > 3 ? std::stoi(argv[3]) : 3;
+
+  std::cout << "num_points, num_values, num_simplices, comparison sort (s), bucket sort (s)" << std::endl;
+  for (int num_values : {16, 256, 4096, 0}) {
+    Simplex_tree st = quantized_flag_complex(num_points, threshold, num_values, max_dim);
+
+    Gudhi::Clock comparison_clock;
+    st.initialize_filtration(0);
+    comparison_clock.end();
+    std::vector<Simplex_tree::Simplex_handle> expected(st.filtration_simplex_range().begin(),
+                                                       st.filtration_simplex_range().end());
+
+    Gudhi::Clock bucket_clock;
+    st.initialize_filtration(std::numeric_limits<std::size_t>::max());
+    bucket_clock.end();
+    std::vector<Simplex_tree::Simplex_handle> result(st.filtration_simplex_range().begin(),
+                                                     st.filtration_simplex_range().end());
+    if (result != expected) {
+      std::cerr << "Different filtration orders" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << num_points << ", " << (num_values > 0 ? std::to_string(num_values) : "all distinct") << ", "
+              << st.num_simplices() << ", " << comparison_clock.num_seconds() << ", " << bucket_clock.num_seconds()
+              << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
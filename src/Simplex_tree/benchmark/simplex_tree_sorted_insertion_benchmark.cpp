@@ -0,0 +1,92 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Clock.h>
+
+#include <algorithm>  // for std::sort, std::reverse
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>  // for std::pair
+#include <vector>
+#include <cmath>  // for std::sqrt
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Vertex_handle = Simplex_tree::Vertex_handle;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Simplex = std::pair<std::vector<Vertex_handle>, Filtration_value>;
+
+/* All the simplices of the flag complex of random points in the unit square, in lexicographic order. */
+std::vector<Simplex> sorted_flag_complex(int num_points, double threshold, int max_dim) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < num_points; ++i)
+    points.emplace_back(coord(gen), coord(gen));
+
+  Simplex_tree st;
+  for (int i = 0; i < num_points; ++i)
+    st.insert_simplex({i}, 0.);
+  for (int i = 0; i < num_points; ++i) {
+    for (int j = i + 1; j < num_points; ++j) {
+      double dx = points[i].first - points[j].first;
+      double dy = points[i].second - points[j].second;
+      double d = std::sqrt(dx * dx + dy * dy);
+      if (d <= threshold) st.insert_simplex({i, j}, d);
+    }
+  }
+  st.expansion(max_dim);
+
+  std::vector<Simplex> simplices;
+  simplices.reserve(st.num_simplices());
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<Vertex_handle> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    std::reverse(simplex.begin(), simplex.end());
+    simplices.emplace_back(std::move(simplex), st.filtration(sh));
+  }
+  std::sort(simplices.begin(), simplices.end());
+  return simplices;
+}
+
+int main(int argc, char* argv[]) {
+  int num_points = argc > 1 ? std::stoi(argv[1]) : 4000;
+  double threshold = argc > 2 ? std::stod(argv[2]) : 0.05;
+  int max_dim = argc > 3 ? std::stoi(argv[3]) : 4;
+
+  std::vector<Simplex> simplices = sorted_flag_complex(num_points, threshold, max_dim);
+  std::cout << simplices.size() << " simplices in lexicographic order" << std::endl;
+
+  Gudhi::Clock subfaces_clock("insert_simplex_and_subfaces");
+  Simplex_tree st_subfaces;
+  for (auto& simplex : simplices)
+    st_subfaces.insert_simplex_and_subfaces(simplex.first, simplex.second);
+  subfaces_clock.end();
+  std::cout << subfaces_clock;
+
+  Gudhi::Clock insert_clock("insert_simplex");
+  Simplex_tree st_insert;
+  for (auto& simplex : simplices)
+    st_insert.insert_simplex(simplex.first, simplex.second);
+  insert_clock.end();
+  std::cout << insert_clock;
+
+  Gudhi::Clock sorted_clock("insert_sorted_simplices");
+  Simplex_tree st_sorted;
+  st_sorted.insert_sorted_simplices(simplices);
+  sorted_clock.end();
+  std::cout << sorted_clock;
+
+  if (!(st_sorted == st_subfaces) || !(st_sorted == st_insert)) {
+    std::cerr << "The complexes differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Clock.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cmath>  // for std::sqrt
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+
+/* Flag complex of random points in the unit square. */
+Simplex_tree flag_complex(int num_points, double threshold, int max_dim) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < num_points; ++i)
+    points.emplace_back(coord(gen), coord(gen));
+
+  Simplex_tree st;
+  for (int i = 0; i < num_points; ++i)
+    st.insert_simplex({i}, 0.);
+  for (int i = 0; i < num_points; ++i) {
+    for (int j = i + 1; j < num_points; ++j) {
+      double dx = points[i].first - points[j].first;
+      double dy = points[i].second - points[j].second;
+      double d = std::sqrt(dx * dx + dy * dy);
+      if (d <= threshold)
+        st.insert_simplex({i, j}, d);
+    }
+  }
+  st.expansion(max_dim);
+  return st;
+}
+
+/* Times the traversals that run concurrently on the subtrees of the vertices. */
+void run(const Simplex_tree& st, double threshold, const std::string& threads) {
+  Gudhi::Clock copy_clock;
+  Simplex_tree copy(st);
+  copy_clock.end();
+
+  Gudhi::Clock count_clock;
+  std::size_t num_simplices = copy.num_simplices();
+  count_clock.end();
+
+  // Only the edges have to be raised, their cofaces follow
+  for (auto sh : copy.skeleton_simplex_range(1))
+    if (copy.dimension(sh) == 1) copy.assign_filtration(sh, 2 * copy.filtration(sh));
+  Gudhi::Clock non_decreasing_clock;
+  copy.make_filtration_non_decreasing();
+  non_decreasing_clock.end();
+
+  Gudhi::Clock prune_clock;
+  copy.prune_above_filtration(threshold);
+  prune_clock.end();
+
+  std::cout << threads << ", " << num_simplices << ", " << copy_clock.num_seconds() << ", "
+            << count_clock.num_seconds() << ", " << non_decreasing_clock.num_seconds() << ", "
+            << prune_clock.num_seconds() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  int num_points = argc > 1 ? std::stoi(argv[1]) : 4000;
+  double threshold = argc > 2 ? std::stod(argv[2]) : 0.05;
+  int max_dim = argc > 3 ? std::stoi(argv[3]) : 3;
+
+  Simplex_tree st = flag_complex(num_points, threshold, max_dim);
+  std::cout << "threads, num_simplices, copy (s), num_simplices (s), make_filtration_non_decreasing (s), "
+            << "prune_above_filtration (s)" << std::endl;
+#ifdef GUDHI_USE_TBB
+  tbb::task_arena serial(1);
+  serial.execute([&] { run(st, threshold, "1"); });
+  run(st, threshold, "all");
+#else
+  run(st, threshold, "1");
+#endif
+  return EXIT_SUCCESS;
+}
@@ -27,5 +27,19 @@ struct SimplexTreeOptions {
   static const bool store_filtration;
   /// If true, the list of vertices present in the complex must always be 0, ..., num_vertices-1, without any hole.
   static constexpr bool contiguous_vertices;
+  /// If true, the internal nodes of the tree are allocated in an arena owned by the `Gudhi::Simplex_tree`, which gives
+  /// all the memory back at once when the tree is destroyed or assigned. The memory of the simplices that are removed
+  /// is only reclaimed at that time.
+  static const bool arena_allocation;
+  /// If true, each node of the tree is linked to the other nodes with the same label (its last vertex), which makes
+  /// `Gudhi::Simplex_tree::cofaces_simplex_range()` and `Gudhi::Simplex_tree::star_simplex_range()` only visit the
+  /// subtrees of the simplices that contain the last vertex of the given simplex, at the cost of two pointers per
+  /// node.
+  static const bool link_nodes_by_label;
+  /// If true, each node of the tree refers to its children with a 32 bits index in a table of the
+  /// `Gudhi::Simplex_tree_siblings` owned by the `Gudhi::Simplex_tree`, instead of a pointer. With 32 bits
+  /// `Vertex_handle`, `Filtration_value` and `Simplex_key`, a simplex then takes 16 bytes instead of 24. Following
+  /// a child costs one more memory access, and there can be at most \f$2^{32}-1\f$ sets of siblings.
+  static const bool packed_nodes;
 };
 
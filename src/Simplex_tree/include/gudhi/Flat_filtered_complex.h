@@ -0,0 +1,391 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef FLAT_FILTERED_COMPLEX_H_
+#define FLAT_FILTERED_COMPLEX_H_
+
+#include <gudhi/Debug_utils.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // for memcpy
+#include <iostream>
+#include <limits>  // for infinity value
+#include <stdexcept>
+#include <utility>  // for pair
+#include <vector>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+namespace Gudhi {
+
+/** \brief Immutable snapshot of a filtered simplicial complex, with all the simplices stored in filtration order in
+ * one contiguous buffer.
+ *
+ * \implements FilteredComplex
+ * \ingroup simplex_tree
+ *
+ * A `Simplex_handle` is the position of the simplex in the filtration. For each simplex, the snapshot stores its
+ * filtration value, its vertices and the `Simplex_handle`s of its facets, the last two in compressed sparse row
+ * arrays. Iterating over the filtration and over the boundaries, as the persistence algorithms do, thus only reads
+ * consecutive memory.
+ *
+ * Once built, the snapshot does not depend on the complex it was built from, which can be destroyed. The complex
+ * cannot be modified through the snapshot, only the keys can be reassigned.
+ *
+ * The buffer can be written with `serialize()`, e.g. to a file, and used in place afterwards, e.g. after mapping
+ * the file in memory, with the constructor from a buffer. The values are in the native binary representation, so
+ * the buffer can only be read back on a platform with the same endianness.
+ */
+template < typename FiltrationValue = double
+, typename SimplexKey = std::uint32_t
+, typename VertexHandle = int
+>
+class Flat_filtered_complex {
+ public:
+  typedef FiltrationValue Filtration_value;
+  typedef SimplexKey Simplex_key;
+  typedef VertexHandle Vertex_handle;
+  /** \brief Position of the simplex in the filtration. */
+  typedef SimplexKey Simplex_handle;
+
+  typedef boost::counting_iterator< Simplex_handle > Filtration_simplex_iterator;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
+
+  typedef const Simplex_handle* Boundary_simplex_iterator;
+  typedef boost::iterator_range<Boundary_simplex_iterator> Boundary_simplex_range;
+
+  typedef const Vertex_handle* Simplex_vertex_iterator;
+  typedef boost::iterator_range<Simplex_vertex_iterator> Simplex_vertex_range;
+
+  typedef const Simplex_handle* Skeleton_simplex_iterator;
+  typedef boost::iterator_range< Skeleton_simplex_iterator > Skeleton_simplex_range;
+
+  /** \brief Builds an empty complex. */
+  Flat_filtered_complex() {
+    allocate(0, 0, 0, -1);
+    attach(reinterpret_cast<const char*>(storage_.data()), layout_.size);
+  }
+
+  /** \brief Builds the snapshot of a complex, e.g. a `Simplex_tree`.
+   *
+   * @param[in] cpx A model of FilteredComplex that also provides `simplex_vertex_range(sh)` and `dimension()`.
+   *
+   * The keys of the simplices of `cpx` are overwritten with their position in the filtration.
+   *
+   * @exception std::out_of_range In case the number of simplices is more than Simplex_key type numeric limit.
+   */
+  template < class Complex_ds >
+  explicit Flat_filtered_complex(Complex_ds & cpx) {
+    const std::size_t num_simp = cpx.num_simplices();
+    if (num_simp >= static_cast<std::size_t>(std::numeric_limits<Simplex_key>::max())) {
+      // A value is reserved for null_key.
+      throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
+    }
+    // First pass: positions and sizes. A simplex of dimension d has d + 1 vertices and d + 1 facets (none for a
+    // vertex, the slot is left unused so that both arrays share the same offsets).
+    std::vector<std::uint64_t> offsets(num_simp + 1);
+    std::size_t num_vert = 0;
+    Simplex_key idx = 0;
+    offsets[0] = 0;
+    for (auto sh : cpx.filtration_simplex_range()) {
+      cpx.assign_key(sh, idx);
+      int dim = cpx.dimension(sh);
+      if (dim == 0)
+        ++num_vert;
+      offsets[idx + 1] = offsets[idx] + dim + 1;
+      ++idx;
+    }
+    allocate(num_simp, num_vert, offsets.back(), cpx.dimension());
+    char* data = reinterpret_cast<char*>(storage_.data());
+    std::copy(offsets.begin(), offsets.end(), reinterpret_cast<std::uint64_t*>(data + layout_.offsets));
+    Filtration_value* filtrations = reinterpret_cast<Filtration_value*>(data + layout_.filtrations);
+    Vertex_handle* simplex_vertices = reinterpret_cast<Vertex_handle*>(data + layout_.simplex_vertices);
+    Simplex_handle* boundaries = reinterpret_cast<Simplex_handle*>(data + layout_.boundaries);
+    Simplex_handle* vertices = reinterpret_cast<Simplex_handle*>(data + layout_.vertices);
+
+    // Second pass: fill the arrays. Each simplex only writes in its own slots.
+    auto fill = [&](Simplex_key i) {
+      auto sh = cpx.simplex(i);
+      filtrations[i] = cpx.filtration(sh);
+      std::size_t pos = offsets[i];
+      for (auto v : cpx.simplex_vertex_range(sh))
+        simplex_vertices[pos++] = v;
+      pos = offsets[i];
+      if (offsets[i + 1] - offsets[i] > 1) {
+        for (auto b_sh : cpx.boundary_simplex_range(sh))
+          boundaries[pos++] = cpx.key(b_sh);
+      } else {
+        boundaries[pos] = null_simplex();
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(Simplex_key(0), idx, fill);
+#else
+    for (Simplex_key i = 0; i < idx; ++i)
+      fill(i);
+#endif
+    std::size_t v_idx = 0;
+    for (Simplex_key i = 0; i < idx; ++i)
+      if (offsets[i + 1] - offsets[i] == 1)
+        vertices[v_idx++] = i;
+    attach(data, layout_.size);
+  }
+
+  /** \brief Uses in place a buffer written by `serialize()`, without copying it. Only the keys are stored apart.
+   *
+   * @param[in] buffer Buffer written by `serialize()`, aligned on 8 bytes, e.g. a file mapped in memory. It must
+   * remain valid and unchanged as long as the complex is used.
+   * @param[in] buffer_size Size of the buffer.
+   * @exception std::invalid_argument If the buffer is not aligned, is too small or was written with different
+   * template parameters.
+   */
+  Flat_filtered_complex(const char* buffer, std::size_t buffer_size) {
+    attach(buffer, buffer_size);
+  }
+
+  Flat_filtered_complex(const Flat_filtered_complex& other)
+      : storage_(other.storage_),
+        keys_(other.keys_) {
+    attach(other.storage_.empty() ? other.data_ : reinterpret_cast<const char*>(storage_.data()), other.data_size_,
+           false);
+  }
+
+  Flat_filtered_complex(Flat_filtered_complex&& other)
+      : storage_(std::move(other.storage_)),
+        keys_(std::move(other.keys_)) {
+    attach(storage_.empty() ? other.data_ : reinterpret_cast<const char*>(storage_.data()), other.data_size_, false);
+    other = Flat_filtered_complex();
+  }
+
+  Flat_filtered_complex& operator=(const Flat_filtered_complex& other) {
+    if (this != &other)
+      *this = Flat_filtered_complex(other);
+    return *this;
+  }
+
+  Flat_filtered_complex& operator=(Flat_filtered_complex&& other) {
+    if (this != &other) {
+      storage_ = std::move(other.storage_);
+      keys_ = std::move(other.keys_);
+      attach(storage_.empty() ? other.data_ : reinterpret_cast<const char*>(storage_.data()), other.data_size_,
+             false);
+      other.storage_.clear();
+      other.keys_.clear();
+      other.allocate(0, 0, 0, -1);
+      other.attach(reinterpret_cast<const char*>(other.storage_.data()), other.layout_.size);
+    }
+    return *this;
+  }
+
+  /** \brief Returns the size in bytes of the buffer needed by `serialize()`. */
+  std::size_t get_serialization_size() const {
+    return data_size_;
+  }
+
+  /** \brief Writes the snapshot in buffer, which can then be used in place by the constructor from a buffer.
+   *
+   * @exception std::invalid_argument If buffer_size is smaller than `get_serialization_size()`.
+   */
+  void serialize(char* buffer, std::size_t buffer_size) const {
+    if (buffer_size < data_size_)
+      throw std::invalid_argument("Flat_filtered_complex::serialize - buffer is too small");
+    std::copy(data_, data_ + data_size_, buffer);
+  }
+
+  /** \brief Returns the number of simplices. */
+  std::size_t num_simplices() const {
+    return num_simplices_;
+  }
+
+  /** \brief Returns the number of vertices. */
+  std::size_t num_vertices() const {
+    return num_vertices_;
+  }
+
+  /** \brief Returns the dimension of the complex. */
+  int dimension() const {
+    return dimension_;
+  }
+
+  /** \brief Returns the dimension of a simplex. */
+  int dimension(Simplex_handle sh) const {
+    return static_cast<int>(offsets_[sh + 1] - offsets_[sh]) - 1;
+  }
+
+  /** \brief Returns the filtration value of a simplex.
+   *
+   * Called on the null_simplex, it returns infinity. */
+  Filtration_value filtration(Simplex_handle sh) const {
+    if (sh == null_simplex()) {
+      return std::numeric_limits<Filtration_value>::infinity();
+    }
+    return filtrations_[sh];
+  }
+
+  Simplex_key key(Simplex_handle sh) const {
+    return keys_[sh];
+  }
+
+  void assign_key(Simplex_handle sh, Simplex_key key) {
+    keys_[sh] = key;
+  }
+
+  static Simplex_key null_key() {
+    return static_cast<Simplex_key>(-1);
+  }
+
+  static Simplex_handle null_simplex() {
+    return static_cast<Simplex_handle>(-1);
+  }
+
+  /** \brief Returns the simplex at position idx in the filtration. */
+  Simplex_handle simplex(Simplex_key idx) const {
+    if (idx == null_key()) return null_simplex();
+    return idx;
+  }
+
+  /** \brief The simplices are stored in filtration order, there is nothing to do. */
+  void initialize_filtration() const { }
+
+  Filtration_simplex_range filtration_simplex_range() const {
+    return Filtration_simplex_range(Filtration_simplex_iterator(0),
+                                    Filtration_simplex_iterator(static_cast<Simplex_handle>(num_simplices_)));
+  }
+
+  /** \brief Returns a range over the facets of a simplex, empty for a vertex. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) const {
+    if (dimension(sh) == 0) {
+      return Boundary_simplex_range(boundaries_ + offsets_[sh], boundaries_ + offsets_[sh]);
+    }
+    return Boundary_simplex_range(boundaries_ + offsets_[sh], boundaries_ + offsets_[sh + 1]);
+  }
+
+  /** \brief Returns a range over the vertices of a simplex, in the order given by the original complex. */
+  Simplex_vertex_range simplex_vertex_range(Simplex_handle sh) const {
+    return Simplex_vertex_range(simplex_vertices_ + offsets_[sh], simplex_vertices_ + offsets_[sh + 1]);
+  }
+
+  /** \brief Returns a range over the vertices of the complex, in filtration order. Only the 0-skeleton is
+   * available. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim = 0) const {
+    if (dim != 0) {
+      std::cerr << "Flat_filtered_complex::skeleton_simplex_range - dimension must be 0\n";
+    }
+    return Skeleton_simplex_range(vertices_, vertices_ + num_vertices_);
+  }
+
+  /** \brief Returns the two vertices of an edge. */
+  std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) const {
+    GUDHI_CHECK(dimension(sh) == 1, std::invalid_argument("Flat_filtered_complex::endpoints - not an edge"));
+    return std::pair<Simplex_handle, Simplex_handle>(boundaries_[offsets_[sh]], boundaries_[offsets_[sh] + 1]);
+  }
+
+ private:
+  // The buffer starts with a Header, followed by the arrays, each one starting on a multiple of 8 bytes:
+  // filtration values, offsets, vertices of the simplices, facets of the simplices and vertices of the complex.
+  // Vertices and facets of simplex sh are in [offsets[sh], offsets[sh + 1]).
+  struct Header {
+    std::uint64_t magic;
+    std::int64_t dimension;
+    std::uint64_t num_simplices;
+    std::uint64_t num_vertices;
+    std::uint64_t num_entries;
+  };
+
+  struct Layout {
+    Layout() : filtrations(0), offsets(0), simplex_vertices(0), boundaries(0), vertices(0), size(0) { }
+    Layout(std::size_t num_simp, std::size_t num_vert, std::size_t num_entries) {
+      filtrations = round_up(sizeof(Header));
+      offsets = round_up(filtrations + num_simp * sizeof(Filtration_value));
+      simplex_vertices = round_up(offsets + (num_simp + 1) * sizeof(std::uint64_t));
+      boundaries = round_up(simplex_vertices + num_entries * sizeof(Vertex_handle));
+      vertices = round_up(boundaries + num_entries * sizeof(Simplex_handle));
+      size = round_up(vertices + num_vert * sizeof(Simplex_handle));
+    }
+    static std::size_t round_up(std::size_t s) {
+      return (s + 7) / 8 * 8;
+    }
+    std::size_t filtrations, offsets, simplex_vertices, boundaries, vertices, size;
+  };
+
+  // Identifies the format and the types it was written with.
+  static std::uint64_t magic() {
+    return (std::uint64_t(0x47464643) << 32) | (sizeof(Filtration_value) << 16) | (sizeof(Vertex_handle) << 8) |
+           sizeof(Simplex_key);
+  }
+
+  void allocate(std::size_t num_simp, std::size_t num_vert, std::size_t num_entries, int dim) {
+    layout_ = Layout(num_simp, num_vert, num_entries);
+    storage_.assign(layout_.size / sizeof(std::uint64_t), 0);
+    Header header;
+    header.magic = magic();
+    header.dimension = dim;
+    header.num_simplices = num_simp;
+    header.num_vertices = num_vert;
+    header.num_entries = num_entries;
+    std::memcpy(storage_.data(), &header, sizeof(Header));
+  }
+
+  // Points the arrays in data, and resets the keys if reset_keys.
+  void attach(const char* data, std::size_t data_size, bool reset_keys = true) {
+    if (reinterpret_cast<std::uintptr_t>(data) % 8 != 0)
+      throw std::invalid_argument("Flat_filtered_complex - buffer is not aligned on 8 bytes");
+    Header header;
+    if (data_size < sizeof(Header))
+      throw std::invalid_argument("Flat_filtered_complex - buffer is too small");
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != magic())
+      throw std::invalid_argument("Flat_filtered_complex - buffer of another format or written with other types");
+    layout_ = Layout(header.num_simplices, header.num_vertices, header.num_entries);
+    if (data_size < layout_.size)
+      throw std::invalid_argument("Flat_filtered_complex - buffer is too small");
+    data_ = data;
+    data_size_ = layout_.size;
+    num_simplices_ = header.num_simplices;
+    num_vertices_ = header.num_vertices;
+    dimension_ = static_cast<int>(header.dimension);
+    filtrations_ = reinterpret_cast<const Filtration_value*>(data + layout_.filtrations);
+    offsets_ = reinterpret_cast<const std::uint64_t*>(data + layout_.offsets);
+    simplex_vertices_ = reinterpret_cast<const Vertex_handle*>(data + layout_.simplex_vertices);
+    boundaries_ = reinterpret_cast<const Simplex_handle*>(data + layout_.boundaries);
+    vertices_ = reinterpret_cast<const Simplex_handle*>(data + layout_.vertices);
+    if (reset_keys) {
+      keys_.resize(num_simplices_);
+      for (std::size_t i = 0; i < num_simplices_; ++i)
+        keys_[i] = static_cast<Simplex_key>(i);
+    }
+  }
+
+  // Owned buffer, empty when the complex uses an external buffer.
+  std::vector<std::uint64_t> storage_;
+  std::vector<Simplex_key> keys_;
+  Layout layout_;
+  const char* data_;
+  std::size_t data_size_;
+  std::size_t num_simplices_;
+  std::size_t num_vertices_;
+  int dimension_;
+  const Filtration_value* filtrations_;
+  const std::uint64_t* offsets_;
+  const Vertex_handle* simplex_vertices_;
+  const Simplex_handle* boundaries_;
+  const Simplex_handle* vertices_;
+};
+
+}  // namespace Gudhi
+
+#endif  // FLAT_FILTERED_COMPLEX_H_
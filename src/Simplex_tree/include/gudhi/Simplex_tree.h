@@ -13,20 +13,30 @@
 
 #include <gudhi/Simplex_tree/Simplex_tree_node_explicit_storage.h>
 #include <gudhi/Simplex_tree/Simplex_tree_siblings.h>
+#include <gudhi/Simplex_tree/Simplex_tree_siblings_pool.h>
 #include <gudhi/Simplex_tree/Simplex_tree_iterators.h>
 #include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Simplex_tree/serialization_utils.h>
+#include <gudhi/Simplex_tree/hooks_simplex_base.h>
+#include <gudhi/Simplex_tree/sorted_intersection.h>
 
 #include <gudhi/reader_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
 #include <gudhi/Debug_utils.h>
+#include <gudhi/Monotonic_arena.h>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 #endif
 
 #include <utility>
@@ -38,6 +48,10 @@
 #include <algorithm>  // for std::max
 #include <cstdint>  // for std::uint32_t
 #include <iterator>  // for std::distance
+#include <memory>  // for std::unique_ptr
+#include <type_traits>  // for std::conditional
+#include <unordered_map>
+#include <numeric>  // for std::iota, std::partial_sum
 
 namespace Gudhi {
 
@@ -77,14 +91,21 @@ class Simplex_tree {
   /* Type of node in the simplex tree. */
   typedef Simplex_tree_node_explicit_storage<Simplex_tree> Node;
   /* Type of dictionary Vertex_handle -> Node for traversing the simplex tree. */
-  // Note: this wastes space when Vertex_handle is 32 bits and Node is aligned on 64 bits. It would be better to use a
-  // flat_set (with our own comparator) where we can control the layout of the struct (put Vertex_handle and
-  // Simplex_key next to each other).
-  typedef typename boost::container::flat_map<Vertex_handle, Node> Dictionary;
+  // Note: this wastes space when Vertex_handle is 32 bits and Node is aligned on 64 bits, because of the pointer to
+  // the children. With Options::packed_nodes, this pointer is replaced by a 32 bits index and there is no padding.
+  typedef typename std::conditional<Options::arena_allocation,
+                                    Arena_allocator<std::pair<Vertex_handle, Node>>,
+                                    boost::container::new_allocator<std::pair<Vertex_handle, Node>>>::type
+      Dictionary_allocator;
+  typedef typename boost::container::flat_map<Vertex_handle, Node, std::less<Vertex_handle>, Dictionary_allocator>
+      Dictionary;
 
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
   typedef Simplex_tree_siblings<Simplex_tree, Dictionary> Siblings;
+  /* Table of the Siblings, if the nodes index them instead of pointing to them. */
+  typedef typename std::conditional<Options::packed_nodes, simplex_tree::Simplex_tree_siblings_pool<Siblings>,
+                                    simplex_tree::Simplex_tree_no_siblings_pool<Siblings>>::type Siblings_pool;
 
   struct Key_simplex_base_real {
     Key_simplex_base_real() : key_(-1) {}
@@ -117,6 +138,10 @@ class Simplex_tree {
   typedef typename std::conditional<Options::store_filtration, Filtration_simplex_base_real,
     Filtration_simplex_base_dummy>::type Filtration_simplex_base;
 
+  typedef simplex_tree::Hooks_simplex_base_link_nodes Hooks_simplex_base_link_nodes;
+  typedef typename std::conditional<Options::link_nodes_by_label, Hooks_simplex_base_link_nodes,
+    simplex_tree::Hooks_simplex_base_dummy>::type Hooks_simplex_base;
+
  public:
   /** \brief Handle type to a simplex contained in the simplicial complex represented
    * by the simplex tree. */
@@ -348,8 +373,9 @@ class Simplex_tree {
   void copy_from(const Simplex_tree& complex_source) {
     null_vertex_ = complex_source.null_vertex_;
     filtration_vect_.clear();
+    clear_boundary_keys();
     dimension_ = complex_source.dimension_;
-    auto root_source = complex_source.root_;
+    const Siblings& root_source = complex_source.root_;
 
     // root members copy
     root_.members() = Dictionary(boost::container::ordered_unique_range, root_source.members().begin(), root_source.members().end());
@@ -357,21 +383,33 @@ class Simplex_tree {
     for (auto& map_el : root_.members()) {
       map_el.second.assign_children(&root_);
     }
-    rec_copy(&root_, &root_source);
+    // The subtrees of the vertices are copied concurrently
+    for_each_vertex_subtree([&](Dictionary_it vertex) {
+      copy_children(&root_, vertex, root_source.members().begin() + (vertex - root_.members().begin()),
+                    complex_source);
+    });
+    link_new_nodes();
   }
 
   /** \brief depth first search, inserts simplices when reaching a leaf. */
-  void rec_copy(Siblings *sib, Siblings *sib_source) {
+  void rec_copy(Siblings *sib, Siblings *sib_source, const Simplex_tree& complex_source) {
     for (auto sh = sib->members().begin(), sh_source = sib_source->members().begin();
          sh != sib->members().end(); ++sh, ++sh_source) {
-      if (has_children(sh_source)) {
-        Siblings * newsib = new Siblings(sib, sh_source->first);
-        newsib->members_.reserve(sh_source->second.children()->members().size());
-        for (auto & child : sh_source->second.children()->members())
-          newsib->members_.emplace_hint(newsib->members_.end(), child.first, Node(newsib, child.second.filtration()));
-        rec_copy(newsib, sh_source->second.children());
-        sh->second.assign_children(newsib);
-      }
+      copy_children(sib, sh, sh_source, complex_source);
+    }
+  }
+
+  /* Copies the subtree below sh_source, if any, below sh, which is a member of sib. */
+  template<class SimplexHandle>
+  void copy_children(Siblings *sib, Dictionary_it sh, SimplexHandle sh_source, const Simplex_tree& complex_source) {
+    if (complex_source.has_children(sh_source)) {
+      Siblings * newsib = new_siblings(sib, sh_source->first);
+      Siblings * children_source = complex_source.children(sh_source);
+      newsib->members_.reserve(children_source->members().size());
+      for (auto & child : children_source->members())
+        newsib->members_.emplace_hint(newsib->members_.end(), child.first, Node(newsib, child.second.filtration()));
+      rec_copy(newsib, children_source, complex_source);
+      sh->second.assign_children(newsib);
     }
   }
 
@@ -380,16 +418,28 @@ class Simplex_tree {
     null_vertex_ = std::move(complex_source.null_vertex_);
     root_ = std::move(complex_source.root_);
     filtration_vect_ = std::move(complex_source.filtration_vect_);
+    boundary_keys_ = std::move(complex_source.boundary_keys_);
+    boundary_keys_offsets_ = std::move(complex_source.boundary_keys_offsets_);
+    complex_source.clear_boundary_keys();
     dimension_ = std::move(complex_source.dimension_);
+    // The Siblings of complex_source live in its arena. Ours is empty, as the tree is.
+    std::swap(arena_, complex_source.arena_);
+    // Same for the table of the Siblings, but each tree keeps its root.
+    siblings_pool_.swap(complex_source.siblings_pool_);
+    siblings_pool_.set_root(&root_);
+    complex_source.siblings_pool_.set_root(&complex_source.root_);
+    // The nodes did not move, only the heads of their lists are transferred.
+    nodes_label_to_list_ = std::move(complex_source.nodes_label_to_list_);
+    complex_source.nodes_label_to_list_.clear();
 
     // Need to update root members (children->oncles and children need to point on the new root pointer)
     for (auto& map_el : root_.members()) {
-      if (map_el.second.children() != &(complex_source.root_)) {
+      if (has_children(&map_el)) {
         // reset children->oncles with the moved root_ pointer value
-        map_el.second.children()->oncles_ = &root_;
+        children(&map_el)->oncles_ = &root_;
       } else {
         // if simplex is of dimension 0, oncles_ shall be nullptr
-        GUDHI_CHECK(map_el.second.children()->oncles_ == nullptr,
+        GUDHI_CHECK(children(&map_el)->oncles_ == nullptr,
                     std::invalid_argument("Simplex_tree move constructor from an invalid Simplex_tree"));
         // and children points on root_ - to be moved
         map_el.second.assign_children(&root_);
@@ -399,31 +449,105 @@ class Simplex_tree {
 
   // delete all root_.members() recursively
   void root_members_recursive_deletion() {
+    if (Options::arena_allocation) {
+      // All the Siblings but root_, and their members, live in the arena
+      root_.members().clear();
+      // The nodes in the arena are released without being destroyed, they cannot unlink themselves
+      for (auto& label_list : nodes_label_to_list_)
+        label_list.second.forget_list();
+      nodes_label_to_list_.clear();
+      arena_->release();
+      siblings_pool_.reset(&root_);
+      return;
+    }
     for (auto sh = root_.members().begin(); sh != root_.members().end(); ++sh) {
       if (has_children(sh)) {
-        rec_delete(sh->second.children());
+        rec_delete(children(sh));
       }
     }
     root_.members().clear();
+    nodes_label_to_list_.clear();
+    siblings_pool_.reset(&root_);
   }
 
   // Recursive deletion
   void rec_delete(Siblings * sib) {
     for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
       if (has_children(sh)) {
-        rec_delete(sh->second.children());
+        rec_delete(children(sh));
       }
     }
-    delete sib;
+    delete_siblings(sib);
+  }
+
+  /* Allocates a Siblings, in the arena if Options::arena_allocation. */
+  template<class... Args>
+  Siblings* new_siblings(Args&&... args) {
+    Siblings* sib =
+        construct_siblings(std::integral_constant<bool, Options::arena_allocation>(), std::forward<Args>(args)...);
+    if (Options::packed_nodes) {
+      sib->pool_index_ = siblings_pool_.add(sib);
+      // The members given to the constructor were assigned the children before the index was known
+      for (auto& member : sib->members())
+        member.second.assign_children(sib);
+    }
+    return sib;
   }
 
+  template<class... Args>
+  Siblings* construct_siblings(std::false_type, Args&&... args) {
+    return new Siblings(std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  Siblings* construct_siblings(std::true_type, Args&&... args) {
+    void* p = arena_->allocate(sizeof(Siblings), alignof(Siblings));
+    return new (p) Siblings(std::forward<Args>(args)..., Dictionary_allocator(arena_.get()));
+  }
+
+  /* Deallocates a Siblings allocated with new_siblings. */
+  void delete_siblings(Siblings* sib) {
+    if (Options::packed_nodes)
+      siblings_pool_.remove(sib->pool_index_);
+    if (Options::arena_allocation)
+      sib->~Siblings();  // the memory is given back with the whole arena
+    else
+      delete sib;
+  }
+
+  /* Links a new node to the other nodes with the same label, if Options::link_nodes_by_label. */
+  void link_node(Simplex_handle sh) {
+    link_node(sh, std::integral_constant<bool, Options::link_nodes_by_label>());
+  }
+
+  void link_node(Simplex_handle sh, std::true_type) {
+    sh->second.link_after(nodes_label_to_list_[sh->first]);
+  }
+
+  void link_node(Simplex_handle, std::false_type) {}
+
+  /* Links all the nodes that are not linked yet, after an operation that inserts many nodes at once (possibly
+   * concurrently) without calling link_node. */
+  void link_new_nodes() {
+    link_new_nodes(std::integral_constant<bool, Options::link_nodes_by_label>());
+  }
+
+  void link_new_nodes(std::true_type) {
+    for (Simplex_handle sh : complex_simplex_range()) {
+      if (!sh->second.is_linked())
+        link_node(sh, std::true_type());
+    }
+  }
+
+  void link_new_nodes(std::false_type) {}
+
  public:
   /** \brief Checks if two simplex trees are equal. */
   bool operator==(Simplex_tree& st2) {
     if ((null_vertex_ != st2.null_vertex_) ||
         (dimension_ != st2.dimension_))
       return false;
-    return rec_equal(&root_, &st2.root_);
+    return rec_equal(&root_, &st2.root_, st2);
   }
 
   /** \brief Checks if two simplex trees are different. */
@@ -433,18 +557,18 @@ class Simplex_tree {
 
  private:
   /** rec_equal: Checks recursively whether or not two simplex trees are equal, using depth first search. */
-  bool rec_equal(Siblings* s1, Siblings* s2) {
+  bool rec_equal(Siblings* s1, Siblings* s2, const Simplex_tree& st2) {
     if (s1->members().size() != s2->members().size())
       return false;
     for (auto sh1 = s1->members().begin(), sh2 = s2->members().begin();
          (sh1 != s1->members().end() && sh2 != s2->members().end()); ++sh1, ++sh2) {
       if (sh1->first != sh2->first || sh1->second.filtration() != sh2->second.filtration())
         return false;
-      if (has_children(sh1) != has_children(sh2))
+      if (has_children(sh1) != st2.has_children(sh2))
         return false;
       // Recursivity on children only if both have children
       else if (has_children(sh1))
-        if (!rec_equal(sh1->second.children(), sh2->second.children()))
+        if (!rec_equal(children(sh1), st2.children(sh2), st2))
           return false;
     }
     return true;
@@ -519,18 +643,21 @@ class Simplex_tree {
  public:
   /** \brief returns the number of simplices in the simplex_tree. */
   size_t num_simplices() {
-    return num_simplices(&root_);
+    // The subtrees of the vertices are counted concurrently
+    return num_vertices() + reduce_vertex_subtrees(std::size_t(0), [this](Dictionary_it vertex) {
+      return has_children(vertex) ? num_simplices(children(vertex)) : std::size_t(0);
+    }, std::plus<std::size_t>());
   }
 
  private:
   /** \brief returns the number of simplices in the simplex_tree. */
-  size_t num_simplices(Siblings * sib) {
+  size_t num_simplices(const Siblings * sib) const {
     auto sib_begin = sib->members().begin();
     auto sib_end = sib->members().end();
     size_t simplices_number = sib_end - sib_begin;
     for (auto sh = sib_begin; sh != sib_end; ++sh) {
       if (has_children(sh)) {
-        simplices_number += num_simplices(sh->second.children());
+        simplices_number += num_simplices(children(sh));
       }
     }
     return simplices_number;
@@ -540,7 +667,7 @@ class Simplex_tree {
   /** \brief Returns the dimension of a simplex.
    *
    * Must be different from null_simplex().*/
-  int dimension(Simplex_handle sh) {
+  int dimension(Simplex_handle sh) const {
     Siblings * curr_sib = self_siblings(sh);
     int dim = 0;
     while (curr_sib != nullptr) {
@@ -570,9 +697,65 @@ class Simplex_tree {
   template<class SimplexHandle>
   bool has_children(SimplexHandle sh) const {
     // Here we rely on the root using null_vertex(), which cannot match any real vertex.
-    return (sh->second.children()->parent() == sh->first);
+    return (children(sh)->parent() == sh->first);
+  }
+
+  /** \brief Returns the Siblings holding the children of a simplex, or the Siblings containing the simplex if it has
+   * no children. */
+  template<class SimplexHandle>
+  Siblings* children(SimplexHandle sh) const {
+    return siblings(sh->second.children());
+  }
+
+ private:
+  static Siblings* siblings(Siblings* sib) {
+    return sib;
+  }
+
+  /* With SimplexTreeOptions::packed_nodes, the children are an index in siblings_pool_. */
+  Siblings* siblings(std::uint32_t index) const {
+    return siblings_pool_[index];
   }
 
+  /* Calls f on each vertex, concurrently with TBB if concurrent. The subtrees rooted at different vertices are
+   * disjoint: f may modify the subtree of its vertex, but only read the others if no other call modifies them. */
+  template<class Function>
+  void for_each_vertex_subtree(Function&& f, bool concurrent = true) {
+    Dictionary& vertices = root_.members_;
+#ifdef GUDHI_USE_TBB
+    if (concurrent) {
+      tbb::parallel_for(std::size_t(0), vertices.size(), [&](std::size_t idx) { f(vertices.begin() + idx); });
+      return;
+    }
+#endif
+    (void)concurrent;
+    for (auto vertex = vertices.begin(); vertex != vertices.end(); ++vertex)
+      f(vertex);
+  }
+
+  /* Combines the results of f on each vertex, as for_each_vertex_subtree. combine must be associative, with identity
+   * as neutral element. */
+  template<class Result, class Function, class Combine>
+  Result reduce_vertex_subtrees(Result identity, Function&& f, Combine combine, bool concurrent = true) {
+    Dictionary& vertices = root_.members_;
+#ifdef GUDHI_USE_TBB
+    if (concurrent) {
+      return tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, vertices.size()), identity,
+                                  [&](const tbb::blocked_range<std::size_t>& range, Result result) {
+                                    for (std::size_t idx = range.begin(); idx != range.end(); ++idx)
+                                      result = combine(result, f(vertices.begin() + idx));
+                                    return result;
+                                  }, combine);
+    }
+#endif
+    (void)concurrent;
+    Result result = identity;
+    for (auto vertex = vertices.begin(); vertex != vertices.end(); ++vertex)
+      result = combine(result, f(vertex));
+    return result;
+  }
+
+ public:
     /** \brief Given a range of Vertex_handles, returns the Simplex_handle
    * of the simplex in the simplicial complex containing the corresponding
    * vertices. Return null_simplex() if the simplex is not in the complex.
@@ -611,7 +794,7 @@ class Simplex_tree {
         return tmp_dit;
       if (!has_children(tmp_dit))
         return null_simplex();
-      tmp_sib = tmp_dit->second.children();
+      tmp_sib = children(tmp_dit);
     }
     for (;;) {
       tmp_dit = tmp_sib->members_.find(*vi++);
@@ -621,7 +804,7 @@ class Simplex_tree {
         return tmp_dit;
       if (!has_children(tmp_dit))
         return null_simplex();
-      tmp_sib = tmp_dit->second.children();
+      tmp_sib = children(tmp_dit);
     }
   }
 
@@ -668,10 +851,13 @@ class Simplex_tree {
     for (; vi != simplex.end() - 1; ++vi) {
       GUDHI_CHECK(*vi != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
       res_insert = curr_sib->members_.emplace(*vi, Node(curr_sib, filtration));
+      if (res_insert.second) {
+        link_node(res_insert.first);
+      }
       if (!(has_children(res_insert.first))) {
-        res_insert.first->second.assign_children(new Siblings(curr_sib, *vi));
+        res_insert.first->second.assign_children(new_siblings(curr_sib, *vi));
       }
-      curr_sib = res_insert.first->second.children();
+      curr_sib = children(res_insert.first);
     }
     GUDHI_CHECK(*vi != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
     res_insert = curr_sib->members_.emplace(*vi, Node(curr_sib, filtration));
@@ -686,6 +872,7 @@ class Simplex_tree {
       return std::pair<Simplex_handle, bool>(null_simplex(), false);
     }
     // otherwise the insertion has succeeded - size is a size_type
+    link_node(res_insert.first);
     if (static_cast<int>(simplex.size()) - 1 > dimension_) {
       // Update dimension if needed
       dimension_ = static_cast<int>(simplex.size()) - 1;
@@ -792,7 +979,9 @@ class Simplex_tree {
     auto insertion_result = dict.emplace(vertex_one, Node(sib, filt));
     Simplex_handle simplex_one = insertion_result.first;
     bool one_is_new = insertion_result.second;
-    if (!one_is_new) {
+    if (one_is_new) {
+      link_node(simplex_one);
+    } else {
       if (filtration(simplex_one) > filt) {
         assign_filtration(simplex_one, filt);
       } else {
@@ -803,14 +992,76 @@ class Simplex_tree {
     if (++first == last) return insertion_result;
     if (!has_children(simplex_one))
       // TODO: have special code here, we know we are building the whole subtree from scratch.
-      simplex_one->second.assign_children(new Siblings(sib, vertex_one));
-    auto res = rec_insert_simplex_and_subfaces_sorted(simplex_one->second.children(), first, last, filt);
+      simplex_one->second.assign_children(new_siblings(sib, vertex_one));
+    auto res = rec_insert_simplex_and_subfaces_sorted(children(simplex_one), first, last, filt);
     // No need to continue if the full simplex was already there with a low enough filtration value.
     if (res.first != null_simplex()) rec_insert_simplex_and_subfaces_sorted(sib, first, last, filt);
     return res;
   }
 
  public:
+  /** \brief Inserts a simplex that comes after all the simplices of the complex in lexicographic order, and whose
+   * facet without its last vertex is already in the complex.
+   *
+   * Simplices are compared by the lexicographic order on their increasing lists of vertices, so the facet without
+   * the last vertex comes before the simplex, and the simplices of a complex given in this order can be inserted one
+   * after the other, e.g. from a file. The other faces of the simplex come after it, the complex is valid once they
+   * are all inserted. The simplex is placed at the end of its `Simplex_tree_siblings`, without any search, which is
+   * much faster than `insert_simplex` or `insert_simplex_and_subfaces`.
+   *
+   * @param[in] simplex Range of Vertex_handles, in increasing order.
+   * @param[in] filtration The filtration value assigned to the new simplex.
+   * @return The Simplex_handle of the new simplex, or null_simplex() if the conditions above are not satisfied, in
+   * which case the complex is not modified.
+   */
+  template<class InputVertexRange = std::initializer_list<Vertex_handle>>
+  Simplex_handle append_simplex_in_lexicographic_order(const InputVertexRange& simplex,
+                                                       Filtration_value filtration = 0) {
+    auto first = std::begin(simplex);
+    auto last = std::end(simplex);
+    if (first == last) return null_simplex();
+
+    // Follow the last simplices inserted, which are the last members of their Siblings.
+    Siblings* sib = &root_;
+    int dim = 0;
+    for (auto next = std::next(first); next != last; first = next, ++next, ++dim) {
+      if (sib->members_.empty() || sib->members_.rbegin()->first != *first || !(*first < *next))
+        return null_simplex();
+      Simplex_handle sh = std::prev(sib->members_.end());
+      if (!has_children(sh)) {
+        if (std::next(next) != last) return null_simplex();
+        sh->second.assign_children(new_siblings(sib, *first));
+      }
+      sib = children(sh);
+    }
+    if (!sib->members_.empty() && !(sib->members_.rbegin()->first < *first))
+      return null_simplex();
+    GUDHI_CHECK(*first != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
+    if (dim > dimension_) dimension_ = dim;
+    Simplex_handle sh = sib->members_.emplace_hint(sib->members_.end(), *first, Node(sib, filtration));
+    link_node(sh);
+    return sh;
+  }
+
+  /** \brief Inserts simplices sorted in lexicographic order, see `append_simplex_in_lexicographic_order`.
+   *
+   * The simplices must come after those already in the complex, which is always the case if it is empty, and each
+   * face of a simplex must either be in the complex or in the range.
+   *
+   * @param[in] simplices Range of pairs made of a range of Vertex_handles, in increasing order, and of a
+   * filtration value.
+   * @exception std::invalid_argument In case a simplex does not come after the previous ones or a face is missing.
+   * The simplices before it remain inserted.
+   */
+  template<class InputSimplexRange>
+  void insert_sorted_simplices(const InputSimplexRange& simplices) {
+    for (auto&& simplex_and_filtration : simplices) {
+      if (append_simplex_in_lexicographic_order(simplex_and_filtration.first, simplex_and_filtration.second) ==
+          null_simplex())
+        throw std::invalid_argument("Simplices are not sorted in lexicographic order or a face is missing");
+    }
+  }
+
   /** \brief Assign a value 'key' to the key of the simplex
    * represented by the Simplex_handle 'sh'. */
   void assign_key(Simplex_handle sh, Simplex_key key) {
@@ -827,11 +1078,11 @@ class Simplex_tree {
 
   /** Returns the Siblings containing a simplex.*/
   template<class SimplexHandle>
-  Siblings* self_siblings(SimplexHandle sh) {
-    if (sh->second.children()->parent() == sh->first)
-      return sh->second.children()->oncles();
+  Siblings* self_siblings(SimplexHandle sh) const {
+    if (children(sh)->parent() == sh->first)
+      return children(sh)->oncles();
     else
-      return sh->second.children();
+      return children(sh);
   }
 
  public:
@@ -849,6 +1100,25 @@ class Simplex_tree {
     dimension_ = dimension;
   }
 
+  /** \brief Prepares the simplicial complex for concurrent read-only queries.
+   *
+   * Initializes the filtration if it has never been, and recomputes the dimension if it has to be lowered, which
+   * are the only computations that the queries otherwise do lazily. Afterwards, and as long as the complex is not
+   * modified, the queries, e.g. `find()`, `filtration()`, `num_simplices()`, `dimension()`,
+   * `filtration_simplex_range()`, `skeleton_simplex_range()`, `boundary_simplex_range()`, `star_simplex_range()` or
+   * `cofaces_simplex_range()`, only read the tree and take no lock: they can be called concurrently from several
+   * threads. The complex must be sealed again after being modified.
+   *
+   * If the complex has changed since the last time the filtration was initialized, please call
+   * `initialize_filtration()` before.
+   */
+  void seal() {
+    if (filtration_vect_.empty())
+      initialize_filtration();
+    if (dimension_to_be_lowered_)
+      lower_upper_bound_dimension();
+  }
+
  public:
   /** \brief Initializes the filtrations, i.e. sort the
    * simplices according to their order in the filtration and initializes all Simplex_keys.
@@ -858,9 +1128,22 @@ class Simplex_tree {
    * simplicial complex with m simplices).
    *
    * Will be automatically called when calling filtration_simplex_range()
-   * if the filtration has never been initialized yet. */
-  void initialize_filtration() {
+   * if the filtration has never been initialized yet.
+   *
+   * @param[in] max_distinct_values When the filtration values are of an arithmetic type and take at most this
+   * number of distinct values, the simplices are distributed in buckets by filtration value, and each bucket is sorted
+   * on integer keys encoding the vertices, which is much faster than comparing the simplices. The resulting order is
+   * the same. The distinct values are counted first, and the comparison sort is used as soon as there are more of
+   * them, so a continuous filtration only pays for a partial traversal. 0, the default, always uses the comparison
+   * sort.
+   */
+  void initialize_filtration(std::size_t max_distinct_values = 0) {
     filtration_vect_.clear();
+    clear_boundary_keys();
+    if (max_distinct_values > 0 &&
+        bucket_sort_filtration(max_distinct_values, std::is_arithmetic<Filtration_value>()))
+      return;
+
     filtration_vect_.reserve(num_simplices());
     for (Simplex_handle sh : complex_simplex_range())
       filtration_vect_.push_back(sh);
@@ -882,6 +1165,300 @@ class Simplex_tree {
   }
 
  private:
+  typedef std::pair<std::uint64_t, Simplex_handle> Keyed_simplex;
+
+  /* Filtration values that cannot be hashed are always sorted by comparison. */
+  bool bucket_sort_filtration(std::size_t, std::false_type) {
+    return false;
+  }
+
+  /* Fills filtration_vect_ with a counting sort on the rank of the filtration values, followed by a sort of each
+   * bucket on a key packing the positions, among the vertices, of the last vertices of the simplex. The key is
+   * ordered like reverse_lexicographic_order, which breaks the ties of is_before_in_filtration, so only simplices
+   * with more vertices than the key holds may still need to be compared. Returns false, leaving filtration_vect_
+   * empty, if there are more than max_distinct_values distinct filtration values. */
+  bool bucket_sort_filtration(std::size_t max_distinct_values, std::true_type) {
+    const std::size_t num_simplices = this->num_simplices();
+    if (num_simplices >= std::numeric_limits<std::uint32_t>::max())
+      return false;
+
+    // Index of each filtration value, in order of first appearance. Counted before anything is built, to give up
+    // early on continuous filtrations.
+    std::unordered_map<Filtration_value, std::uint32_t> value_index;
+    Filtration_value last_value = 0;
+    bool first_value = true;
+    for (Simplex_handle sh : complex_simplex_range()) {
+      Filtration_value f = sh->second.filtration();
+      if (first_value || f != last_value) {
+        if (f != f) return false;  // NaN
+        value_index.emplace(f, static_cast<std::uint32_t>(value_index.size()));
+        if (value_index.size() > max_distinct_values) return false;
+        last_value = f;
+        first_value = false;
+      }
+    }
+
+    std::vector<Keyed_simplex> keyed;
+    keyed.reserve(num_simplices);
+    int key_bits = 1;
+    while (key_bits < 32 && (std::uint64_t(1) << key_bits) <= root_.members_.size())
+      ++key_bits;
+    rec_reverse_lexicographic_keys(&root_, 0, key_bits, (64 / key_bits - 1) * key_bits, keyed);
+
+    std::vector<std::uint32_t> bucket;
+    bucket.reserve(num_simplices);
+    std::uint32_t last_index = 0;
+    first_value = true;
+    for (const Keyed_simplex& ks : keyed) {
+      Filtration_value f = ks.second->second.filtration();
+      if (first_value || f != last_value) {
+        last_value = f;
+        last_index = value_index.find(f)->second;
+        first_value = false;
+      }
+      bucket.push_back(last_index);
+    }
+
+    // Replace indices by ranks.
+    const std::size_t num_values = value_index.size();
+    std::vector<Filtration_value> values(num_values);
+    for (auto& value_and_index : value_index)
+      values[value_and_index.second] = value_and_index.first;
+    std::vector<std::uint32_t> by_value(num_values);
+    std::iota(by_value.begin(), by_value.end(), 0);
+    std::sort(by_value.begin(), by_value.end(),
+              [&values](std::uint32_t a, std::uint32_t b) { return values[a] < values[b]; });
+    std::vector<std::uint32_t> rank(num_values);
+    for (std::size_t r = 0; r < num_values; ++r)
+      rank[by_value[r]] = static_cast<std::uint32_t>(r);
+
+    // Stable counting sort on the rank of the filtration value.
+    std::vector<std::size_t> count(num_values + 1, 0);
+    for (std::uint32_t& b : bucket) {
+      b = rank[b];
+      ++count[b + 1];
+    }
+    std::partial_sum(count.begin(), count.end(), count.begin());
+    std::vector<Keyed_simplex> sorted(num_simplices);
+    std::vector<std::size_t> bucket_begin(count.begin(), count.end());
+    for (std::size_t i = 0; i < num_simplices; ++i)
+      sorted[count[bucket[i]]++] = keyed[i];
+    std::vector<Keyed_simplex>().swap(keyed);
+
+    auto sort_bucket = [this, &sorted, &bucket_begin](std::size_t value_rank) {
+      auto first = sorted.begin() + bucket_begin[value_rank];
+      auto last = sorted.begin() + bucket_begin[value_rank + 1];
+      auto by_key = [](const Keyed_simplex& a, const Keyed_simplex& b) { return a.first < b.first; };
+#ifdef GUDHI_USE_TBB
+      // A filtration with one or a few values has a few large buckets, sorted in parallel themselves.
+      if (last - first > (1 << 16))
+        tbb::parallel_sort(first, last, by_key);
+      else
+#endif
+        std::sort(first, last, by_key);
+      // Equal keys come from simplices with too many vertices, compare them completely.
+      is_before_in_filtration is_before(this);
+      while (first != last) {
+        auto run_end = std::find_if(first + 1, last, [first](const Keyed_simplex& ks) {
+          return ks.first != first->first;
+        });
+        if (run_end - first > 1)
+          std::sort(first, run_end, [&is_before](const Keyed_simplex& a, const Keyed_simplex& b) {
+            return is_before(a.second, b.second);
+          });
+        first = run_end;
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_values, sort_bucket);
+#else
+    for (std::size_t value_rank = 0; value_rank < num_values; ++value_rank)
+      sort_bucket(value_rank);
+#endif
+
+    filtration_vect_.reserve(num_simplices);
+    for (const Keyed_simplex& ks : sorted)
+      filtration_vect_.push_back(ks.second);
+    return true;
+  }
+
+  /* Depth-first traversal computing the keys on the way. The key of a simplex holds 1 + the position among the
+   * vertices of its last vertex in the highest field, of its second to last vertex in the next one, and so on, with 0
+   * when there is no such vertex. The key of a child is obtained by shifting the key of its parent and writing the new
+   * vertex in the highest field. */
+  void rec_reverse_lexicographic_keys(Siblings* sib, std::uint64_t parent_key, int key_bits, int top_shift,
+                                      std::vector<Keyed_simplex>& keyed) {
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      std::uint64_t position = find_vertex(sh->first) - root_.members_.begin();
+      std::uint64_t key = ((position + 1) << top_shift) | (parent_key >> key_bits);
+      keyed.emplace_back(key, sh);
+      if (has_children(sh))
+        rec_reverse_lexicographic_keys(children(sh), key, key_bits, top_shift, keyed);
+    }
+  }
+
+ public:
+
+  /** \brief Updates the order of the simplices in the filtration after some simplices were inserted, removed, or
+   * had their filtration value modified.
+   *
+   * The result is the same as with `initialize_filtration()`, but the previous order is reused: the keys of the
+   * simplices must give their position in this previous order, which is the case after a call to
+   * `update_filtration()` or after a persistence computation with `Persistent_cohomology`. New simplices have a
+   * null key. Only the new simplices, and those whose key no longer gives them a consistent position, are sorted;
+   * they are then merged with the others by `std::inplace_merge`. For \f$n\f$ simplices of which \f$m\f$ are new or
+   * modified, the cost is \f$O(n + m \log m)\f$ comparisons: a traversal of the complex, the sort of the \f$m\f$
+   * simplices and the merge (\f$O(n \log n)\f$ if the merge cannot allocate its buffer).
+   *
+   * After calling this method, each simplex is assigned a Simplex_key corresponding to its order in the filtration
+   * (from 0 to m-1 for a simplicial complex with m simplices).
+   *
+   * \pre SimplexTreeOptions::store_key
+   */
+  void update_filtration() {
+    static_assert(Options::store_key, "update_filtration needs the keys of the simplices");
+    const std::size_t previous_size = filtration_vect_.size();
+    is_before_in_filtration is_before(this);
+    // Simplices that were in the previous filtration, at their position. Removed simplices leave holes.
+    std::vector<Simplex_handle> previous(previous_size, null_simplex());
+    std::vector<Simplex_handle> modified;
+    for (Simplex_handle sh : complex_simplex_range()) {
+      Simplex_key k = sh->second.key();
+      if (k != null_key() && static_cast<std::size_t>(k) < previous_size && previous[k] == null_simplex())
+        previous[k] = sh;
+      else
+        modified.push_back(sh);
+    }
+    previous.erase(std::remove(previous.begin(), previous.end(), null_simplex()), previous.end());
+
+    // Keep an increasing subsequence. A simplex whose filtration value was modified is out of order with one of its
+    // neighbours, it is sorted again with the new ones.
+    filtration_vect_.clear();
+    clear_boundary_keys();
+    filtration_vect_.reserve(previous.size() + modified.size());
+    for (std::size_t i = 0; i < previous.size(); ++i) {
+      Simplex_handle sh = previous[i];
+      if ((filtration_vect_.empty() || is_before(filtration_vect_.back(), sh)) &&
+          (i + 1 == previous.size() || is_before(sh, previous[i + 1])))
+        filtration_vect_.push_back(sh);
+      else
+        modified.push_back(sh);
+    }
+
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_sort(modified.begin(), modified.end(), is_before);
+#else
+    std::stable_sort(modified.begin(), modified.end(), is_before);
+#endif
+    auto middle = filtration_vect_.insert(filtration_vect_.end(), modified.begin(), modified.end());
+    std::inplace_merge(filtration_vect_.begin(), middle, filtration_vect_.end(), is_before);
+
+    Simplex_key k = 0;
+    for (Simplex_handle sh : filtration_vect_)
+      sh->second.assign_key(k++);
+  }
+
+  /** \brief Range over the keys of the boundary of a simplex, see `boundary_keys()`. */
+  typedef boost::iterator_range<typename std::vector<Simplex_key>::const_iterator> Boundary_keys_range;
+
+  /** \brief Computes and stores, once for all, the keys of the boundary of every simplex.
+   *
+   * Each simplex is first assigned a Simplex_key corresponding to its order in the filtration (from 0 to m-1 for a
+   * simplicial complex with m simplices), initializing the filtration if it has never been. The keys of the facets of
+   * all the simplices are then stored contiguously, in the order of the filtration, and `boundary_keys()` returns them
+   * without walking up and down the tree as `boundary_simplex_range()` does, which is what `Persistent_cohomology`
+   * then uses. The facets of a simplex are found from the ones of its parent, so the cost is linear in the size of
+   * the cache, and with TBB the work is shared out by vertex.
+   *
+   * The cache takes \f$ (d+1) \f$ keys per simplex of dimension \f$ d \geq 1 \f$. It is dropped by any method that
+   * recomputes the filtration, and can be released earlier with `clear_boundary_keys()`, typically as soon as the
+   * persistence has been computed. Modifying the complex (inserting or removing simplices, assigning keys) in the
+   * meantime leaves it invalid.
+   *
+   * \pre SimplexTreeOptions::store_key
+   */
+  void initialize_boundary_keys() {
+    static_assert(Options::store_key, "initialize_boundary_keys needs the keys of the simplices");
+    if (filtration_vect_.empty()) initialize_filtration();
+    const std::size_t num_simplices = filtration_vect_.size();
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_simplices, [this](std::size_t idx) {
+      filtration_vect_[idx]->second.assign_key(static_cast<Simplex_key>(idx));
+    });
+#else
+    for (std::size_t idx = 0; idx < num_simplices; ++idx)
+      filtration_vect_[idx]->second.assign_key(static_cast<Simplex_key>(idx));
+#endif
+
+    // A simplex of dimension d >= 1 has d + 1 facets, a vertex none.
+    std::vector<std::size_t> offsets(num_simplices + 1, 0);
+    for (std::size_t idx = 0; idx < num_simplices; ++idx) {
+      int dim = dimension(filtration_vect_[idx]);
+      offsets[idx + 1] = offsets[idx] + (dim > 0 ? dim + 1 : 0);
+    }
+    std::vector<Simplex_key> keys(offsets.back());
+    boundary_keys_offsets_.swap(offsets);
+    boundary_keys_.swap(keys);
+
+    auto boundary_keys_of_vertex = [this](Dictionary_it vertex) {
+      if (!has_children(vertex)) return;
+      std::vector<Siblings*> facets_children(1, &root_);
+      fill_boundary_keys(children(vertex), vertex, facets_children);
+    };
+    for_each_vertex_subtree(boundary_keys_of_vertex);
+  }
+
+  /** \brief Returns whether the boundary keys are stored, see `initialize_boundary_keys()`. */
+  bool has_boundary_keys() const {
+    return !boundary_keys_offsets_.empty();
+  }
+
+  /** \brief Returns the keys of the facets of the simplex of key `key`, in the order of `boundary_simplex_range()`.
+   *
+   * \pre `initialize_boundary_keys()` has been called, and the complex has not been modified since.
+   */
+  Boundary_keys_range boundary_keys(Simplex_key key) const {
+    GUDHI_CHECK(static_cast<std::size_t>(key) + 1 < boundary_keys_offsets_.size(),
+                std::invalid_argument("Simplex_tree::boundary_keys - the boundary keys are not initialized"));
+    return Boundary_keys_range(boundary_keys_.begin() + boundary_keys_offsets_[key],
+                               boundary_keys_.begin() + boundary_keys_offsets_[key + 1]);
+  }
+
+  /** \brief Releases the memory used by the boundary keys, see `initialize_boundary_keys()`. */
+  void clear_boundary_keys() {
+    std::vector<Simplex_key>().swap(boundary_keys_);
+    std::vector<std::size_t>().swap(boundary_keys_offsets_);
+  }
+
+ private:
+  /* Stores the boundary keys of the simplices of sib, children of the simplex parent. facets_children holds, in the
+   * order of boundary_simplex_range(parent), the children of the facets of parent: the facets of a child w are parent
+   * itself, then the children w of these. As sib and the facets children are sorted by label, they are walked
+   * together. */
+  void fill_boundary_keys(Siblings* sib, Dictionary_it parent, const std::vector<Siblings*>& facets_children) {
+    const Simplex_key parent_key = key(parent);
+    std::vector<Dictionary_it> cursors;
+    cursors.reserve(facets_children.size());
+    for (Siblings* facet_children : facets_children)
+      cursors.push_back(facet_children->members().begin());
+    std::vector<Siblings*> next_facets_children;
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      Simplex_key* out = boundary_keys_.data() + boundary_keys_offsets_[key(sh)];
+      *out++ = parent_key;
+      for (Dictionary_it& cursor : cursors) {
+        while (cursor->first < sh->first) ++cursor;
+        *out++ = key(cursor);
+      }
+      if (has_children(sh)) {
+        next_facets_children.clear();
+        next_facets_children.push_back(sib);
+        for (Dictionary_it cursor : cursors)
+          next_facets_children.push_back(children(cursor));
+        fill_boundary_keys(children(sh), sh, next_facets_children);
+      }
+    }
+  }
+
   /** Recursive search of cofaces
    * This function uses DFS
    *\param vertices contains a list of vertices, which represent the vertices of the simplex not found yet.
@@ -908,7 +1485,7 @@ class Simplex_tree {
         if (addCoface)
           cofaces.push_back(simplex);
         if ((!addCoface || star) && has_children(simplex))  // Rec call
-          rec_coface(vertices, simplex->second.children(), curr_nbVertices + 1, cofaces, star, nbVertices);
+          rec_coface(vertices, children(simplex), curr_nbVertices + 1, cofaces, star, nbVertices);
       } else {
         if (simplex->first == vertices.back()) {
           // If curr_sib matches with the top vertex
@@ -920,7 +1497,7 @@ class Simplex_tree {
             // Rec call
             Vertex_handle tmp = vertices.back();
             vertices.pop_back();
-            rec_coface(vertices, simplex->second.children(), curr_nbVertices + 1, cofaces, star, nbVertices);
+            rec_coface(vertices, children(simplex), curr_nbVertices + 1, cofaces, star, nbVertices);
             vertices.push_back(tmp);
           }
         } else if (simplex->first > vertices.back()) {
@@ -928,7 +1505,7 @@ class Simplex_tree {
         } else {
           // (simplex->first < vertices.back()
           if (has_children(simplex))
-            rec_coface(vertices, simplex->second.children(), curr_nbVertices + 1, cofaces, star, nbVertices);
+            rec_coface(vertices, children(simplex), curr_nbVertices + 1, cofaces, star, nbVertices);
         }
       }
     }
@@ -949,6 +1526,10 @@ class Simplex_tree {
    * \param codimension The function returns the n+codimension-cofaces of the n-simplex. If codimension = 0, 
    * return all cofaces (equivalent of star function)
    * \return Vector of Simplex_handle, empty vector if no cofaces found.
+   *
+   * If SimplexTreeOptions::link_nodes_by_label, only the subtrees of the simplices that have the same largest vertex
+   * as the given simplex and contain it are traversed, instead of the whole tree. The cofaces are then returned in a
+   * different order.
    */
 
   Cofaces_simplex_range cofaces_simplex_range(const Simplex_handle simplex, int codimension) {
@@ -963,10 +1544,53 @@ class Simplex_tree {
     // must be sorted in decreasing order
     assert(std::is_sorted(copy.begin(), copy.end(), std::greater<Vertex_handle>()));
     bool star = codimension == 0;
-    rec_coface(copy, &root_, 1, cofaces, star, codimension + static_cast<int>(copy.size()));
+    collect_cofaces(copy, cofaces, star, codimension + static_cast<int>(copy.size()),
+                    std::integral_constant<bool, Options::link_nodes_by_label>());
     return cofaces;
   }
 
+ private:
+  void collect_cofaces(std::vector<Vertex_handle>& vertices, std::vector<Simplex_handle>& cofaces, bool star,
+                       int nbVertices, std::false_type) {
+    rec_coface(vertices, &root_, 1, cofaces, star, nbVertices);
+  }
+
+  /* Each coface has a face with the same largest vertex vertices[0] as the simplex, that is its prefix in the tree:
+   * only the subtrees of the nodes labelled vertices[0] that contain the simplex are visited. */
+  void collect_cofaces(std::vector<Vertex_handle>& vertices, std::vector<Simplex_handle>& cofaces, bool star,
+                       int nbVertices, std::true_type) {
+    auto label_list = nodes_label_to_list_.find(vertices[0]);
+    if (label_list == nodes_label_to_list_.end())
+      return;
+    std::vector<Vertex_handle> no_vertices;
+    const Hooks_simplex_base_link_nodes* head = &label_list->second;
+    for (Hooks_simplex_base_link_nodes* hook = head->next(); hook != head; hook = hook->next()) {
+      Node* node = static_cast<Node*>(hook);
+      Siblings* sib = siblings(node->children());
+      if (sib->parent() == vertices[0])  // the node has children
+        sib = sib->oncles();
+      // Compare the other vertices of the node, all smaller than vertices[0], with the ones of the simplex.
+      auto vertex_it = vertices.begin() + 1;
+      int curr_nbVertices = 1;
+      Siblings* curr_sib = sib;
+      for (; curr_sib != &root_; curr_sib = curr_sib->oncles(), ++curr_nbVertices) {
+        if (vertex_it == vertices.end()) continue;
+        if (curr_sib->parent() == *vertex_it)
+          ++vertex_it;
+        else if (curr_sib->parent() < *vertex_it)
+          break;  // *vertex_it is missing
+      }
+      if (curr_sib != &root_ || vertex_it != vertices.end())
+        continue;
+      Simplex_handle sh = sib->members_.find(vertices[0]);
+      bool add_coface = star || curr_nbVertices == nbVertices;
+      if (add_coface)
+        cofaces.push_back(sh);
+      if ((!add_coface || star) && has_children(sh))
+        rec_coface(no_vertices, children(sh), curr_nbVertices + 1, cofaces, star, nbVertices);
+    }
+  }
+
  private:
   /** \brief Returns true iff the list of vertices of sh1
    * is smaller than the list of vertices of sh2 w.r.t.
@@ -1080,12 +1704,13 @@ class Simplex_tree {
       if (v < u) std::swap(u, v);
       auto sh = find_vertex(u);
       if (!has_children(sh)) {
-        sh->second.assign_children(new Siblings(&root_, sh->first));
+        sh->second.assign_children(new_siblings(&root_, sh->first));
       }
 
-      sh->second.children()->members().emplace(v,
-          Node(sh->second.children(), boost::get(edge_filtration_t(), skel_graph, edge)));
+      children(sh)->members().emplace(v,
+          Node(children(sh), boost::get(edge_filtration_t(), skel_graph, edge)));
     }
+    link_new_nodes();
   }
 
   /** \brief Expands the Simplex_tree containing only its one skeleton
@@ -1097,26 +1722,105 @@ class Simplex_tree {
    * The filtration value assigned to a simplex is the maximal filtration
    * value of one of its edges.
    *
+   * With TBB, the subtrees rooted at the different vertices are expanded concurrently.
+   *
    * The Simplex_tree must contain no simplex of dimension bigger than
    * 1 when calling the method. */
   void expansion(int max_dim) {
     if (max_dim <= 1) return;
-    dimension_ = max_dim;
-    for (Dictionary_it root_it = root_.members_.begin();
-         root_it != root_.members_.end(); ++root_it) {
+    std::vector<std::vector<Vertex_handle>> neighbors = vertices_children_labels();
+    // The expansion below a vertex only modifies the subtree of this vertex, and only reads the edges (whose
+    // children are the only thing written by other tasks) of the other vertices.
+    int lowest_k = reduce_vertex_subtrees(max_dim, [&](Dictionary_it root_it) {
+      int vertex_lowest_k = max_dim;
       if (has_children(root_it)) {
-        siblings_expansion(root_it->second.children(), max_dim - 1);
+        vertex_children_expansion(children(root_it), max_dim - 1, vertex_lowest_k, neighbors);
       }
-    }
-    dimension_ = max_dim - dimension_;
+      return vertex_lowest_k;
+    }, [](int k1, int k2) { return (std::min)(k1, k2); });
+    dimension_ = max_dim - lowest_k;
+    link_new_nodes();
   }
 
  private:
-  /** \brief Recursive expansion of the simplex tree.*/
+  /** \brief Returns the labels of the children of each vertex, indexed by the position of the vertex in the root.
+   *
+   * The labels of a Dictionary are interleaved with the Nodes, these contiguous copies of the edges are intersected
+   * during the expansion. */
+  std::vector<std::vector<Vertex_handle>> vertices_children_labels() {
+    std::vector<std::vector<Vertex_handle>> labels(root_.members_.size());
+    for (auto root_it = root_.members_.begin(); root_it != root_.members_.end(); ++root_it) {
+      if (has_children(root_it)) {
+        std::vector<Vertex_handle>& vertex_labels = labels[root_it - root_.members_.begin()];
+        vertex_labels.reserve(children(root_it)->members().size());
+        for (auto& child : children(root_it)->members())
+          vertex_labels.push_back(child.first);
+      }
+    }
+    return labels;
+  }
+
+  /** \brief Returns the labels of the members of siblings, contiguous. */
+  static std::vector<Vertex_handle> siblings_labels(Siblings* siblings) {
+    std::vector<Vertex_handle> labels;
+    labels.reserve(siblings->members().size());
+    for (auto& member : siblings->members())
+      labels.push_back(member.first);
+    return labels;
+  }
+
+  /** \brief Expansion of the children of a vertex, whose labels are contiguous in neighbors, as the ones of the
+   * children of each vertex. These first level intersections, the largest ones, are vectorized. */
+  void vertex_children_expansion(Siblings * siblings,  // must contain elements
+                                 int k, int& lowest_k, const std::vector<std::vector<Vertex_handle>>& neighbors) {
+    if (lowest_k > k) {
+      lowest_k = k;
+    }
+    if (k == 0)
+      return;
+    Dictionary_it next = siblings->members().begin();
+    ++next;
+
+#ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    thread_local
+#endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    std::vector<std::pair<Vertex_handle, Node> > inter;
+    const std::vector<Vertex_handle>& labels = neighbors[find_vertex(siblings->parent()) - root_.members_.begin()];
+    std::size_t pos = 1;
+    for (Dictionary_it s_h = siblings->members().begin();
+         s_h != siblings->members().end(); ++s_h, ++next, ++pos) {
+      Simplex_handle root_sh = find_vertex(s_h->first);
+      if (has_children(root_sh)) {
+        intersection(
+                     inter,  // output intersection
+                     next,  // begin
+                     labels.data() + pos, labels.size() - pos,
+                     children(root_sh)->members().begin(),
+                     neighbors[root_sh - root_.members_.begin()],
+                     s_h->second.filtration());
+        if (inter.size() != 0) {
+          Siblings * new_sib = new_siblings(siblings,  // oncles
+                                            s_h->first,  // parent
+                                            inter);  // boost::container::ordered_unique_range_t
+          inter.clear();
+          s_h->second.assign_children(new_sib);
+          siblings_expansion(new_sib, k - 1, lowest_k);
+        } else {
+          // ensure the children property
+          s_h->second.assign_children(siblings);
+          inter.clear();
+        }
+      }
+    }
+  }
+
+  /** \brief Recursive expansion of the simplex tree.
+   *
+   * lowest_k is lowered to the smallest k reached, which gives the dimension of the expanded complex.*/
   void siblings_expansion(Siblings * siblings,  // must contain elements
-                          int k) {
-    if (dimension_ > k) {
-      dimension_ = k;
+                          int k, int& lowest_k) {
+    if (lowest_k > k) {
+      lowest_k = k;
     }
     if (k == 0)
       return;
@@ -1135,16 +1839,16 @@ class Simplex_tree {
                      inter,  // output intersection
                      next,  // begin
                      siblings->members().end(),  // end
-                     root_sh->second.children()->members().begin(),
-                     root_sh->second.children()->members().end(),
+                     children(root_sh)->members().begin(),
+                     children(root_sh)->members().end(),
                      s_h->second.filtration());
         if (inter.size() != 0) {
-          Siblings * new_sib = new Siblings(siblings,  // oncles
+          Siblings * new_sib = new_siblings(siblings,  // oncles
                                             s_h->first,  // parent
                                             inter);  // boost::container::ordered_unique_range_t
           inter.clear();
           s_h->second.assign_children(new_sib);
-          siblings_expansion(new_sib, k - 1);
+          siblings_expansion(new_sib, k - 1, lowest_k);
         } else {
           // ensure the children property
           s_h->second.assign_children(siblings);
@@ -1178,6 +1882,18 @@ class Simplex_tree {
     }
   }
 
+  /** \brief Same as above, where the labels of Dictionary 1 are [labels1, labels1 + size1) and the ones of Dictionary
+   * 2 are labels2, with a vectorized intersection of the labels. */
+  static void intersection(std::vector<std::pair<Vertex_handle, Node> >& intersection,
+                           Dictionary_it begin1, const Vertex_handle* labels1, std::size_t size1,
+                           Dictionary_it begin2, const std::vector<Vertex_handle>& labels2,
+                           Filtration_value filtration_) {
+    simplex_tree::intersect_sorted(labels1, size1, labels2.data(), labels2.size(), [&](std::size_t i, std::size_t j) {
+      Filtration_value filt = (std::max)({begin1[i].second.filtration(), begin2[j].second.filtration(), filtration_});
+      intersection.emplace_back(labels1[i], Node(nullptr, filt));
+    });
+  }
+
  public:
   /** \brief Expands a simplex tree containing only a graph. Simplices corresponding to cliques in the graph are added
    * incrementally, faces before cofaces, unless the simplex has dimension larger than `max_dim` or `block_simplex`
@@ -1199,18 +1915,68 @@ class Simplex_tree {
    */
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    std::vector<std::vector<Vertex_handle>> neighbors = vertices_children_labels();
     // Loop must be from the end to the beginning, as higher dimension simplex are always on the left part of the tree
     for (auto& simplex : boost::adaptors::reverse(root_.members())) {
       if (has_children(&simplex)) {
-        siblings_expansion_with_blockers(simplex.second.children(), max_dim, max_dim - 1, block_simplex);
+        siblings_expansion_with_blockers(children(&simplex), max_dim, max_dim - 1, block_simplex, neighbors);
       }
     }
+    link_new_nodes();
+  }
+
+  /** \brief Expands a simplex tree containing only a graph, like `expansion_with_blockers()`, but dimension by
+   * dimension, so that all the candidates of a given dimension can be examined concurrently.
+   *
+   * @param[in] max_dim Expansion maximal dimension value.
+   * @param[in] block_simplex Blocker oracle. Its concept is <CODE>bool block_simplex(Simplex_handle sh)</CODE>
+   *
+   * All the simplices of dimension \f$k\f$ are inserted, vetted by `block_simplex` and the blocked ones removed,
+   * before any candidate of dimension \f$k+1\f$ is considered. When the answer of `block_simplex` only depends on the
+   * simplex it is given, the resulting complex is the same as the one built by `expansion_with_blockers()`.
+   *
+   * @warning With TBB, `block_simplex` is called concurrently from several threads on different simplices. It may read
+   * the complex and modify the filtration value of the simplex it is given, but must not modify anything else.
+   */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    std::vector<std::vector<Vertex_handle>> neighbors = vertices_children_labels();
+    std::vector<Siblings*> current_level;
+    for (auto& simplex : root_.members()) {
+      if (has_children(&simplex)) {
+        current_level.push_back(children(&simplex));
+      }
+    }
+    // current_level contains the Siblings holding the simplices of dimension dim.
+    for (int dim = 1; !current_level.empty(); ++dim) {
+      if (dimension_ < dim) {
+        dimension_ = dim;
+      }
+      if (dim >= max_dim)
+        break;
+      std::vector<Siblings*> next_level;
+#ifdef GUDHI_USE_TBB
+      tbb::enumerable_thread_specific<std::vector<Siblings*>> next_level_local;
+      tbb::parallel_for(std::size_t(0), current_level.size(), [&](std::size_t idx) {
+        siblings_level_expansion_with_blockers(current_level[idx], next_level_local.local(), block_simplex,
+                                               neighbors);
+      });
+      for (auto& local_level : next_level_local)
+        next_level.insert(next_level.end(), local_level.begin(), local_level.end());
+#else
+      for (Siblings* siblings : current_level)
+        siblings_level_expansion_with_blockers(siblings, next_level, block_simplex, neighbors);
+#endif
+      current_level.swap(next_level);
+    }
+    link_new_nodes();
   }
 
  private:
   /** \brief Recursive expansion with blockers of the simplex tree.*/
   template< typename Blocker >
-  void siblings_expansion_with_blockers(Siblings* siblings, int max_dim, int k, Blocker block_simplex) {
+  void siblings_expansion_with_blockers(Siblings* siblings, int max_dim, int k, Blocker block_simplex,
+                                        const std::vector<std::vector<Vertex_handle>>& neighbors) {
     if (dimension_ < max_dim - k) {
       dimension_ = max_dim - k;
     }
@@ -1219,60 +1985,100 @@ class Simplex_tree {
     // No need to go deeper
     if (siblings->members().size() < 2)
       return;
+    std::vector<Vertex_handle> labels = siblings_labels(siblings);
     // Reverse loop starting before the last one for 'next' to be the last one
     for (auto simplex = siblings->members().rbegin() + 1; simplex != siblings->members().rend(); simplex++) {
-      std::vector<std::pair<Vertex_handle, Node> > intersection;
-      for(auto next = siblings->members().rbegin(); next != simplex; next++) {
-        bool to_be_inserted = true;
-        Filtration_value filt = simplex->second.filtration();
-        // If all the boundaries are present, 'next' needs to be inserted
-        for (Simplex_handle border : boundary_simplex_range(simplex)) {
-          Simplex_handle border_child = find_child(border, next->first);
-          if (border_child == null_simplex()) {
-            to_be_inserted=false;
-            break;
-          }
-          filt = (std::max)(filt, filtration(border_child));
-        }
-        if (to_be_inserted) {
-          intersection.emplace_back(next->first, Node(nullptr, filt));
-        }
+      Siblings * new_sib = new_siblings_with_blockers(siblings, labels, simplex, block_simplex, neighbors);
+      if (new_sib != nullptr) {
+        siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex, neighbors);
       }
-      if (intersection.size() != 0) {
-        // Reverse the order to insert
-        Siblings * new_sib = new Siblings(siblings,  // oncles
-                                          simplex->first,  // parent
-                                          boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
-        std::vector<Vertex_handle> blocked_new_sib_vertex_list;
-        // As all intersections are inserted, we can call the blocker function on all new_sib members
-        for (auto new_sib_member = new_sib->members().begin();
-             new_sib_member != new_sib->members().end();
-             new_sib_member++) {
-           bool blocker_result = block_simplex(new_sib_member);
-           // new_sib member has been blocked by the blocker function
-           // add it to the list to be removed - do not perform it while looping on it
-           if (blocker_result) {
-             blocked_new_sib_vertex_list.push_back(new_sib_member->first);
-           }
-        }
-        if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
-          // Specific case where all have to be deleted
-          delete new_sib;
-          // ensure the children property
-          simplex->second.assign_children(siblings);
-        } else {
-          for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
-            new_sib->members().erase(blocked_new_sib_member);
-          }
-          // ensure recursive call
-          simplex->second.assign_children(new_sib);
-          siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex);
+    }
+  }
+
+  /** \brief Expansion with blockers of one Siblings, without recursion. The Siblings created are appended to
+   * new_level.*/
+  template< typename Blocker >
+  void siblings_level_expansion_with_blockers(Siblings* siblings, std::vector<Siblings*>& new_level,
+                                              Blocker& block_simplex,
+                                              const std::vector<std::vector<Vertex_handle>>& neighbors) {
+    if (siblings->members().size() < 2)
+      return;
+    std::vector<Vertex_handle> labels = siblings_labels(siblings);
+    for (auto simplex = siblings->members().rbegin() + 1; simplex != siblings->members().rend(); simplex++) {
+      Siblings * new_sib = new_siblings_with_blockers(siblings, labels, simplex, block_simplex, neighbors);
+      if (new_sib != nullptr) {
+        new_level.push_back(new_sib);
+      }
+    }
+  }
+
+  /** \brief Creates the children of simplex, i.e. the cofaces of simplex whose faces are all in the complex and that
+   * are not blocked. Returns the new Siblings, or nullptr if simplex has no such children.*/
+  template< typename Blocker >
+  Siblings* new_siblings_with_blockers(Siblings* siblings, const std::vector<Vertex_handle>& labels,
+                                       typename Dictionary::reverse_iterator simplex, Blocker& block_simplex,
+                                       const std::vector<std::vector<Vertex_handle>>& neighbors) {
+    std::vector<std::pair<Vertex_handle, Node> > intersection;
+    // Only the vertices after simplex that are neighbors of its last vertex are candidates
+    std::vector<std::size_t> candidates;
+    std::size_t simplex_pos = (siblings->members().rend() - simplex) - 1;
+    Simplex_handle root_sh = find_vertex(simplex->first);
+    if (has_children(root_sh)) {
+      const std::vector<Vertex_handle>& vertex_neighbors = neighbors[root_sh - root_.members_.begin()];
+      simplex_tree::intersect_sorted(labels.data() + simplex_pos + 1, labels.size() - simplex_pos - 1,
+                                     vertex_neighbors.data(), vertex_neighbors.size(),
+                                     [&](std::size_t i, std::size_t) { candidates.push_back(simplex_pos + 1 + i); });
+    }
+    for (auto candidate = candidates.rbegin(); candidate != candidates.rend(); ++candidate) {
+      Dictionary_it next = siblings->members().begin() + *candidate;
+      bool to_be_inserted = true;
+      Filtration_value filt = simplex->second.filtration();
+      // If all the boundaries are present, 'next' needs to be inserted
+      for (Simplex_handle border : boundary_simplex_range(simplex)) {
+        Simplex_handle border_child = find_child(border, next->first);
+        if (border_child == null_simplex()) {
+          to_be_inserted=false;
+          break;
         }
-      } else {
+        filt = (std::max)(filt, filtration(border_child));
+      }
+      if (to_be_inserted) {
+        intersection.emplace_back(next->first, Node(nullptr, filt));
+      }
+    }
+    if (intersection.size() != 0) {
+      // Reverse the order to insert
+      Siblings * new_sib = new_siblings(siblings,  // oncles
+                                        simplex->first,  // parent
+                                        boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
+      std::vector<Vertex_handle> blocked_new_sib_vertex_list;
+      // As all intersections are inserted, we can call the blocker function on all new_sib members
+      for (auto new_sib_member = new_sib->members().begin();
+           new_sib_member != new_sib->members().end();
+           new_sib_member++) {
+         bool blocker_result = block_simplex(new_sib_member);
+         // new_sib member has been blocked by the blocker function
+         // add it to the list to be removed - do not perform it while looping on it
+         if (blocker_result) {
+           blocked_new_sib_vertex_list.push_back(new_sib_member->first);
+         }
+      }
+      if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
+        // Specific case where all have to be deleted
+        delete_siblings(new_sib);
         // ensure the children property
         simplex->second.assign_children(siblings);
+        return nullptr;
+      }
+      for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
+        new_sib->members().erase(blocked_new_sib_member);
       }
+      simplex->second.assign_children(new_sib);
+      return new_sib;
     }
+    // ensure the children property
+    simplex->second.assign_children(siblings);
+    return nullptr;
   }
 
   /* \private Returns the Simplex_handle composed of the vertex list (from the Simplex_handle), plus the given
@@ -1283,10 +2089,10 @@ class Simplex_tree {
     if (!has_children(sh))
       return null_simplex();
 
-    Simplex_handle child = sh->second.children()->find(vh);
+    Simplex_handle child = children(sh)->find(vh);
     // Specific case of boost::flat_map does not find, returns boost::flat_map::end()
     // in simplex tree we want a null_simplex()
-    if (child == sh->second.children()->members().end())
+    if (child == children(sh)->members().end())
       return null_simplex();
 
     return child;
@@ -1320,12 +2126,22 @@ class Simplex_tree {
    */
   bool make_filtration_non_decreasing() {
     bool modified = false;
+#ifdef GUDHI_USE_TBB
+    // The facets of a simplex are in the subtrees of other vertices, which may not have been processed yet: the
+    // simplices are processed dimension by dimension, and those of the same dimension concurrently.
+    for (int dim = 1; dim <= dimension_; ++dim) {
+      modified |= reduce_vertex_subtrees(false, [&](Dictionary_it vertex) {
+        return has_children(vertex) && make_filtration_non_decreasing_at_depth(children(vertex), dim - 1);
+      }, std::logical_or<bool>());
+    }
+#else
     // Loop must be from the end to the beginning, as higher dimension simplex are always on the left part of the tree
     for (auto& simplex : boost::adaptors::reverse(root_.members())) {
       if (has_children(&simplex)) {
-        modified |= rec_make_filtration_non_decreasing(simplex.second.children());
+        modified |= rec_make_filtration_non_decreasing(children(&simplex));
       }
     }
+#endif
     return modified;
   }
 
@@ -1339,27 +2155,45 @@ class Simplex_tree {
 
     // Loop must be from the end to the beginning, as higher dimension simplex are always on the left part of the tree
     for (auto& simplex : boost::adaptors::reverse(sib->members())) {
-      // Find the maximum filtration value in the border
-      Boundary_simplex_range boundary = boundary_simplex_range(&simplex);
-      Boundary_simplex_iterator max_border = std::max_element(std::begin(boundary), std::end(boundary),
-                                                              [](Simplex_handle sh1, Simplex_handle sh2) {
-                                                                return filtration(sh1) < filtration(sh2);
-                                                              });
-
-      Filtration_value max_filt_border_value = filtration(*max_border);
-      if (simplex.second.filtration() < max_filt_border_value) {
-        // Store the filtration modification information
-        modified = true;
-        simplex.second.assign_filtration(max_filt_border_value);
-      }
+      modified |= raise_filtration_to_facets(&simplex);
       if (has_children(&simplex)) {
-        modified |= rec_make_filtration_non_decreasing(simplex.second.children());
+        modified |= rec_make_filtration_non_decreasing(children(&simplex));
       }
     }
     // Make the modified information to be traced by upper call
     return modified;
   }
 
+  /* Same as rec_make_filtration_non_decreasing, only for the simplices depth levels below sib. */
+  bool make_filtration_non_decreasing_at_depth(Siblings * sib, int depth) {
+    bool modified = false;
+    for (auto& simplex : sib->members()) {
+      if (depth == 0)
+        modified |= raise_filtration_to_facets(&simplex);
+      else if (has_children(&simplex))
+        modified |= make_filtration_non_decreasing_at_depth(children(&simplex), depth - 1);
+    }
+    return modified;
+  }
+
+  /* Raises the filtration value of a simplex of dimension at least 1 to the maximum of the ones of its facets. */
+  bool raise_filtration_to_facets(Dit_value_t* simplex) {
+    // Find the maximum filtration value in the border
+    Boundary_simplex_range boundary = boundary_simplex_range(simplex);
+    Boundary_simplex_iterator max_border = std::max_element(std::begin(boundary), std::end(boundary),
+                                                            [](Simplex_handle sh1, Simplex_handle sh2) {
+                                                              return filtration(sh1) < filtration(sh2);
+                                                            });
+
+    Filtration_value max_filt_border_value = filtration(*max_border);
+    if (simplex->second.filtration() < max_filt_border_value) {
+      // Store the filtration modification information
+      simplex->second.assign_filtration(max_filt_border_value);
+      return true;
+    }
+    return false;
+  }
+
  public:
   /** \brief Prune above filtration value given as parameter.
    * @param[in] filtration Maximum threshold value.
@@ -1372,35 +2206,44 @@ class Simplex_tree {
    * bound. If you care, you can call `dimension()` to recompute the exact dimension.
    */
   bool prune_above_filtration(Filtration_value filtration) {
-    return rec_prune_above_filtration(root(), filtration);
+    bool modified = remove_members_above_filtration(&root_, filtration);
+    // The subtrees of the remaining vertices are pruned concurrently, unless the nodes are linked by label: removing a
+    // node then modifies its neighbours in the list of its label, which may be in other subtrees.
+    modified |= reduce_vertex_subtrees(false, [&](Dictionary_it vertex) {
+      return has_children(vertex) && rec_prune_above_filtration(children(vertex), filtration);
+    }, std::logical_or<bool>(), !Options::link_nodes_by_label);
+    if (modified)
+      // dimension may need to be lowered
+      dimension_to_be_lowered_ = true;
+    return modified;
   }
 
  private:
   bool rec_prune_above_filtration(Siblings* sib, Filtration_value filt) {
+    bool modified = remove_members_above_filtration(sib, filt);
+    if (sib->members().empty()) {
+      // Removing the whole siblings, parent becomes a leaf.
+      sib->oncles()->members()[sib->parent()].assign_children(sib->oncles());
+      delete_siblings(sib);
+      return true;
+    }
+    // Keeping some elements of siblings, recurse in the remaining ones.
+    for (auto&& simplex : sib->members())
+      if (has_children(&simplex))
+        modified |= rec_prune_above_filtration(children(&simplex), filt);
+    return modified;
+  }
+
+  /* Removes the members of sib, with their subtrees, whose filtration value is above filt. */
+  bool remove_members_above_filtration(Siblings* sib, Filtration_value filt) {
     auto&& list = sib->members();
     auto last = std::remove_if(list.begin(), list.end(), [=](Dit_value_t& simplex) {
         if (simplex.second.filtration() <= filt) return false;
-        if (has_children(&simplex)) rec_delete(simplex.second.children());
-        // dimension may need to be lowered
-        dimension_to_be_lowered_ = true;
+        if (has_children(&simplex)) rec_delete(children(&simplex));
         return true;
       });
-
     bool modified = (last != list.end());
-    if (last == list.begin() && sib != root()) {
-      // Removing the whole siblings, parent becomes a leaf.
-      sib->oncles()->members()[sib->parent()].assign_children(sib->oncles());
-      delete sib;
-      // dimension may need to be lowered
-      dimension_to_be_lowered_ = true;
-      return true;
-    } else {
-      // Keeping some elements of siblings. Remove the others, and recurse in the remaining ones.
-      list.erase(last, list.end());
-      for (auto&& simplex : list)
-        if (has_children(&simplex))
-          modified |= rec_prune_above_filtration(simplex.second.children(), filt);
-    }
+    list.erase(last, list.end());
     return modified;
   }
 
@@ -1450,7 +2293,7 @@ class Simplex_tree {
                 std::invalid_argument("Simplex_tree::remove_maximal_simplex - argument has children"));
 
     // Simplex is a leaf, it means the child is the Siblings owning the leaf
-    Siblings* child = sh->second.children();
+    Siblings* child = children(sh);
 
     if ((child->size() > 1) || (child == root())) {
       // Not alone, just remove it from members
@@ -1459,19 +2302,298 @@ class Simplex_tree {
     } else {
       // Sibling is emptied : must be deleted, and its parent must point on his own Sibling
       child->oncles()->members().at(child->parent()).assign_children(child->oncles());
-      delete child;
+      delete_siblings(child);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
     }
   }
 
+  /** \brief Memory used by a simplex tree, in bytes, as returned by `memory_usage()`.
+   *
+   * The vectors are indexed by dimension. The `Simplex_tree` object itself, of size `sizeof(Simplex_tree)`, is not
+   * counted. */
+  struct Memory_usage {
+    /** \brief Memory of the nodes representing the simplices of each dimension. */
+    std::vector<std::size_t> nodes;
+    /** \brief Memory of the `Simplex_tree_siblings` objects, without their members, holding the simplices of each
+     * dimension. The root, part of the `Simplex_tree` object, is not counted. */
+    std::vector<std::size_t> siblings;
+    /** \brief Memory allocated by the dictionaries of the `Simplex_tree_siblings` holding the simplices of each
+     * dimension beyond their size. It can be given back with `shrink_to_fit()`. */
+    std::vector<std::size_t> unused_capacity;
+    /** \brief Memory of the filtration ordering computed by `initialize_filtration()`. */
+    std::size_t filtration_vector = 0;
+    /** \brief Memory of the boundary keys stored by `initialize_boundary_keys()`. */
+    std::size_t boundary_keys = 0;
+    /** \brief Estimated memory of the heads of the lists of nodes with the same label, if
+     * SimplexTreeOptions::link_nodes_by_label. */
+    std::size_t label_lists = 0;
+    /** \brief Memory of the table of the `Simplex_tree_siblings` indexed by the nodes, if
+     * SimplexTreeOptions::packed_nodes. */
+    std::size_t siblings_pool = 0;
+    /** \brief Memory of the arena that is used by none of the above, if SimplexTreeOptions::arena_allocation: the
+     * end of the current blocks, the removed simplices and the dictionaries that were reallocated when growing. */
+    std::size_t arena_unused = 0;
+
+    /** \brief Total memory of the simplex tree, without the `Simplex_tree` object. */
+    std::size_t total() const {
+      std::size_t sum = filtration_vector + boundary_keys + label_lists + siblings_pool + arena_unused;
+      for (std::size_t dim = 0; dim < nodes.size(); ++dim)
+        sum += nodes[dim] + siblings[dim] + unused_capacity[dim];
+      return sum;
+    }
+  };
+
+  /** \brief Returns the memory used by the simplex tree, broken down by dimension.
+   *
+   * The sizes are computed from the capacity of the containers, not asked to the memory allocator, which may use a
+   * bit more. */
+  Memory_usage memory_usage() {
+    Memory_usage usage;
+    rec_memory_usage(&root_, 0, usage);
+    usage.filtration_vector = filtration_vect_.capacity() * sizeof(Simplex_handle);
+    usage.boundary_keys = boundary_keys_.capacity() * sizeof(Simplex_key) +
+                          boundary_keys_offsets_.capacity() * sizeof(std::size_t);
+    if (Options::link_nodes_by_label) {
+      // Approximation of the layout of a node based std::unordered_map
+      usage.label_lists = nodes_label_to_list_.size() *
+                              (sizeof(typename decltype(nodes_label_to_list_)::value_type) + 2 * sizeof(void*)) +
+                          nodes_label_to_list_.bucket_count() * sizeof(void*);
+    }
+    usage.siblings_pool = siblings_pool_.memory_usage();
+    if (Options::arena_allocation) {
+      // Everything but root_ and its members lives in the arena
+      std::size_t in_arena = usage.total() - usage.filtration_vector - usage.boundary_keys - usage.label_lists -
+                             usage.siblings_pool -
+                             root_.members().capacity() * sizeof(typename Dictionary::value_type);
+      usage.arena_unused = arena_->allocated_bytes() > in_arena ? arena_->allocated_bytes() - in_arena : 0;
+    }
+    return usage;
+  }
+
+  /** \brief Gives back the memory allocated by the dictionaries of the simplex tree beyond their size, as left by
+   * `insert_graph()`, `expansion()` or removals.
+   *
+   * \post The Simplex_handle's are invalidated and `initialize_filtration()` must be called again, as after an
+   * insertion. The memory of the filtration ordering and of the boundary keys is released.
+   *
+   * With SimplexTreeOptions::arena_allocation, only the root dictionary is shrunk, as the memory of the other ones
+   * can only be given back with the whole arena.
+   */
+  void shrink_to_fit() {
+    std::vector<Simplex_handle>().swap(filtration_vect_);
+    clear_boundary_keys();
+    root_.members().shrink_to_fit();
+    if (!Options::arena_allocation) {
+      for (auto sh = root_.members().begin(); sh != root_.members().end(); ++sh)
+        if (has_children(sh))
+          rec_shrink_to_fit(children(sh));
+    }
+  }
+
+ private:
+  void rec_memory_usage(Siblings* sib, std::size_t dim, Memory_usage& usage) {
+    if (usage.nodes.size() <= dim) {
+      usage.nodes.resize(dim + 1, 0);
+      usage.siblings.resize(dim + 1, 0);
+      usage.unused_capacity.resize(dim + 1, 0);
+    }
+    usage.nodes[dim] += sib->members().size() * sizeof(typename Dictionary::value_type);
+    usage.unused_capacity[dim] +=
+        (sib->members().capacity() - sib->members().size()) * sizeof(typename Dictionary::value_type);
+    if (sib != &root_)
+      usage.siblings[dim] += sizeof(Siblings);
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh)
+      if (has_children(sh))
+        rec_memory_usage(children(sh), dim + 1, usage);
+  }
+
+  void rec_shrink_to_fit(Siblings* sib) {
+    sib->members().shrink_to_fit();
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh)
+      if (has_children(sh))
+        rec_shrink_to_fit(children(sh));
+  }
+
+ public:
+  /** \brief Returns the size in bytes of the buffer needed by `serialize()`.
+   *
+   * @param[in] with_keys Whether the keys of the simplices are serialized. Ignored if
+   * `SimplexTreeOptions::store_key` is false. */
+  std::size_t get_serialization_size(bool with_keys = false) {
+    with_keys = with_keys && Options::store_key;
+    const std::size_t node_size = 2 * sizeof(Vertex_handle) +
+        (Options::store_filtration ? sizeof(Filtration_value) : 0) + (with_keys ? sizeof(Simplex_key) : 0);
+    return serialization_header_size + sizeof(Vertex_handle) + num_simplices() * node_size;
+  }
+
+  /** \brief Writes the simplex tree in a compact binary form, from which `deserialize()` can rebuild it.
+   *
+   * @param[out] buffer Where to write, at least `get_serialization_size(with_keys)` bytes long.
+   * @param[in] buffer_size Size of the buffer.
+   * @param[in] with_keys Whether the keys of the simplices are serialized. Ignored if
+   * `SimplexTreeOptions::store_key` is false.
+   * @exception std::invalid_argument If the buffer is too small.
+   *
+   * The tree is written depth first: the members of a Siblings (vertex, filtration value if
+   * `SimplexTreeOptions::store_filtration`, key if requested) are preceded by their number and followed by the
+   * Siblings of their children. The values are in the native binary representation, so the buffer can only be read
+   * back on a platform with the same endianness.
+   */
+  void serialize(char* buffer, const std::size_t buffer_size, bool with_keys = false) {
+    with_keys = with_keys && Options::store_key;
+    if (buffer_size < get_serialization_size(with_keys))
+      throw std::invalid_argument("Simplex_tree::serialize - buffer is too small");
+    char* ptr = buffer;
+    ptr = simplex_tree::serialize_trivial(static_cast<std::uint8_t>((Options::store_filtration ? 1 : 0) |
+                                                                    (with_keys ? 2 : 0)), ptr);
+    ptr = simplex_tree::serialize_trivial(static_cast<std::uint8_t>(sizeof(Vertex_handle)), ptr);
+    ptr = simplex_tree::serialize_trivial(static_cast<std::uint8_t>(sizeof(Filtration_value)), ptr);
+    ptr = simplex_tree::serialize_trivial(static_cast<std::uint8_t>(sizeof(Simplex_key)), ptr);
+    rec_serialize(&root_, ptr, with_keys);
+  }
+
+  /** \brief Rebuilds a simplex tree from a buffer written by `serialize()`.
+   *
+   * The tree is built top-down, each Siblings being filled in one go, without any search.
+   *
+   * @param[in] buffer Buffer written by `serialize()`.
+   * @param[in] buffer_size Size of the buffer.
+   * @exception std::invalid_argument If the simplex tree is not empty, or if the buffer is too small or was
+   * written with a different `Vertex_handle` or `Filtration_value` type. The simplex tree is then left empty.
+   *
+   * Filtration values or keys present in the buffer are skipped if the simplex tree does not store them.
+   */
+  void deserialize(const char* buffer, const std::size_t buffer_size) {
+    if (num_vertices() != 0)
+      throw std::invalid_argument("Simplex_tree::deserialize - Simplex_tree must be empty");
+    const char* ptr = buffer;
+    const char* end = buffer + buffer_size;
+    std::uint8_t flags, vertex_size, filtration_size, key_size;
+    ptr = simplex_tree::deserialize_trivial(flags, ptr, end);
+    ptr = simplex_tree::deserialize_trivial(vertex_size, ptr, end);
+    ptr = simplex_tree::deserialize_trivial(filtration_size, ptr, end);
+    ptr = simplex_tree::deserialize_trivial(key_size, ptr, end);
+    const bool with_filtration = (flags & 1) != 0;
+    const bool with_keys = (flags & 2) != 0;
+    if (vertex_size != sizeof(Vertex_handle) || (with_filtration && filtration_size != sizeof(Filtration_value)) ||
+        (with_keys && Options::store_key && key_size != sizeof(Simplex_key)))
+      throw std::invalid_argument("Simplex_tree::deserialize - incompatible Vertex_handle, Filtration_value or "
+                                  "Simplex_key type");
+    dimension_ = -1;
+    filtration_vect_.clear();
+    clear_boundary_keys();
+    Vertex_handle root_size;
+    ptr = simplex_tree::deserialize_trivial(root_size, ptr, end);
+    try {
+      rec_deserialize(&root_, root_size, ptr, end, with_filtration ? filtration_size : 0, with_keys ? key_size : 0, 0);
+    } catch (...) {
+      // Leave an empty simplex tree rather than a partially built one
+      root_members_recursive_deletion();
+      dimension_ = -1;
+      throw;
+    }
+    link_new_nodes();
+  }
+
+ private:
+  static constexpr std::size_t serialization_header_size = 4;
+
+  void rec_serialize(Siblings* sib, char*& ptr, bool with_keys) {
+    ptr = simplex_tree::serialize_trivial(static_cast<Vertex_handle>(sib->members().size()), ptr);
+    for (auto& map_el : sib->members()) {
+      ptr = simplex_tree::serialize_trivial(map_el.first, ptr);
+      if (Options::store_filtration)
+        ptr = simplex_tree::serialize_trivial(map_el.second.filtration(), ptr);
+      if (with_keys)
+        ptr = serialize_key(map_el.second, ptr, std::integral_constant<bool, Options::store_key>());
+    }
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      if (has_children(sh)) {
+        rec_serialize(children(sh), ptr, with_keys);
+      } else {
+        ptr = simplex_tree::serialize_trivial(static_cast<Vertex_handle>(0), ptr);
+      }
+    }
+  }
+
+  char* serialize_key(Node& node, char* ptr, std::true_type) {
+    return simplex_tree::serialize_trivial(node.key(), ptr);
+  }
+
+  char* serialize_key(Node&, char* ptr, std::false_type) {
+    return ptr;
+  }
+
+  // Fills sib with its members_size members read from ptr, then their children.
+  // filtration_size and key_size are 0 if the buffer does not contain filtration values or keys.
+  void rec_deserialize(Siblings* sib, Vertex_handle members_size, const char*& ptr, const char* end,
+                       std::size_t filtration_size, std::size_t key_size, int dim) {
+    if (members_size <= 0)
+      return;
+    if (dimension_ < dim)
+      dimension_ = dim;
+    const std::size_t node_size = sizeof(Vertex_handle) + filtration_size + key_size;
+    if (static_cast<std::size_t>(end - ptr) / node_size < static_cast<std::size_t>(members_size))
+      throw std::invalid_argument("Simplex_tree::deserialize - buffer is too small");
+    sib->members().reserve(members_size);
+    for (Vertex_handle i = 0; i < members_size; ++i) {
+      Vertex_handle vertex;
+      Filtration_value filtration = 0;
+      ptr = simplex_tree::deserialize_trivial(vertex, ptr, end);
+      if (filtration_size != 0) {
+        Filtration_value value;
+        ptr = simplex_tree::deserialize_trivial(value, ptr, end);
+        if (Options::store_filtration)
+          filtration = value;
+      }
+      // Vertices are sorted, inserting at the end costs nothing
+      auto sh = sib->members().emplace_hint(sib->members().end(), vertex, Node(sib, filtration));
+      if (key_size != 0)
+        ptr = deserialize_key(sh->second, ptr, end, key_size, std::integral_constant<bool, Options::store_key>());
+    }
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      Vertex_handle children_size;
+      ptr = simplex_tree::deserialize_trivial(children_size, ptr, end);
+      if (children_size > 0) {
+        Siblings* child = new_siblings(sib, sh->first);
+        // Assigned first, so that the child is deleted with the tree if the buffer turns out to be truncated
+        sh->second.assign_children(child);
+        rec_deserialize(child, children_size, ptr, end, filtration_size, key_size, dim + 1);
+      }
+    }
+  }
+
+  const char* deserialize_key(Node& node, const char* ptr, const char* end, std::size_t, std::true_type) {
+    Simplex_key key;
+    ptr = simplex_tree::deserialize_trivial(key, ptr, end);
+    node.assign_key(key);
+    return ptr;
+  }
+
+  const char* deserialize_key(Node&, const char* ptr, const char* end, std::size_t key_size, std::false_type) {
+    if (end - ptr < static_cast<std::ptrdiff_t>(key_size))
+      throw std::invalid_argument("Simplex_tree::deserialize - buffer is too small");
+    return ptr + key_size;
+  }
+
  private:
   Vertex_handle null_vertex_;
+  /** \brief Memory for all the Siblings but root_, if Options::arena_allocation.*/
+  std::unique_ptr<Monotonic_arena> arena_{Options::arena_allocation ? new Monotonic_arena() : nullptr};
+  /** \brief Heads of the lists of nodes with the same label, if Options::link_nodes_by_label.*/
+  std::unordered_map<Vertex_handle, Hooks_simplex_base_link_nodes> nodes_label_to_list_;
   /** \brief Total number of simplices in the complex, without the empty simplex.*/
   /** \brief Set of simplex tree Nodes representing the vertices.*/
   Siblings root_;
+  /** \brief Table of the Siblings, indexed by the nodes instead of pointers if Options::packed_nodes.*/
+  Siblings_pool siblings_pool_{&root_};
   /** \brief Simplices ordered according to a filtration.*/
   std::vector<Simplex_handle> filtration_vect_;
+  /** \brief Keys of the facets of the simplices, in the order of the filtration, see initialize_boundary_keys().*/
+  std::vector<Simplex_key> boundary_keys_;
+  /** \brief Position in boundary_keys_ of the facets of each simplex, plus the end.*/
+  std::vector<std::size_t> boundary_keys_offsets_;
   /** \brief Upper bound on the dimension of the simplicial complex.*/
   int dimension_;
   bool dimension_to_be_lowered_ = false;
@@ -1503,8 +2625,9 @@ std::istream& operator>>(std::istream & is, Simplex_tree<T...> & st) {
     if (max_dim < dim) {
       max_dim = dim;
     }
-    // insert every simplex in the simplex tree
-    st.insert_simplex(simplex, fil);
+    // insert every simplex in the simplex tree, much faster if they are sorted in lexicographic order
+    if (st.append_simplex_in_lexicographic_order(simplex, fil) == st.null_simplex())
+      st.insert_simplex(simplex, fil);
     simplex.clear();
   }
   st.set_dimension(max_dim);
@@ -1524,6 +2647,9 @@ struct Simplex_tree_options_full_featured {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = false;
+  static const bool arena_allocation = false;
+  static const bool link_nodes_by_label = false;
+  static const bool packed_nodes = false;
 };
 
 /** Model of SimplexTreeOptions, faster than `Simplex_tree_options_full_featured` but note the unsafe
@@ -1540,6 +2666,9 @@ struct Simplex_tree_options_fast_persistence {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = true;
+  static const bool arena_allocation = false;
+  static const bool link_nodes_by_label = false;
+  static const bool packed_nodes = false;
 };
 
 /** @} */  // end defgroup simplex_tree
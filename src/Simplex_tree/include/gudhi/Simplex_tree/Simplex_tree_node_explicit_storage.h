@@ -11,6 +11,8 @@
 #ifndef SIMPLEX_TREE_SIMPLEX_TREE_NODE_EXPLICIT_STORAGE_H_
 #define SIMPLEX_TREE_SIMPLEX_TREE_NODE_EXPLICIT_STORAGE_H_
 
+#include <cstdint>
+#include <type_traits>  // for std::conditional
 #include <vector>
 
 namespace Gudhi {
@@ -24,17 +26,24 @@ namespace Gudhi {
  * \brief Node of a simplex tree with filtration value
  * and simplex key.
  *
- * It stores explicitely its own filtration value and its own Simplex_key.
+ * It stores explicitely its own filtration value and its own Simplex_key, and, if
+ * SimplexTreeOptions::link_nodes_by_label, the hooks linking it to the nodes with the same label.
+ *
+ * The children are a pointer to their Siblings or, if SimplexTreeOptions::packed_nodes, the 32 bits index of the
+ * Siblings in the table of the Simplex_tree, which only the Simplex_tree can resolve.
  */
 template<class SimplexTree>
-struct Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base, SimplexTree::Key_simplex_base {
+struct Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base, SimplexTree::Key_simplex_base,
+                                            SimplexTree::Hooks_simplex_base {
   typedef typename SimplexTree::Siblings Siblings;
   typedef typename SimplexTree::Filtration_value Filtration_value;
   typedef typename SimplexTree::Simplex_key Simplex_key;
+  typedef typename std::conditional<SimplexTree::Options::packed_nodes, std::uint32_t, Siblings*>::type
+      Children_handle;
 
   Simplex_tree_node_explicit_storage(Siblings * sib = nullptr,
-                                     Filtration_value filtration = 0)
-      : children_(sib) {
+                                     Filtration_value filtration = 0) {
+    assign_children(sib);
     this->assign_filtration(filtration);
   }
 
@@ -42,16 +51,24 @@ struct Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base
    * Assign children to the node
    */
   void assign_children(Siblings * children) {
-    children_ = children;
+    children_ = children_handle(children, std::integral_constant<bool, SimplexTree::Options::packed_nodes>());
   }
 
   /* Careful -> children_ can be NULL*/
-  Siblings * children() {
+  Children_handle children() const {
     return children_;
   }
 
  private:
-  Siblings * children_;
+  static Siblings* children_handle(Siblings* children, std::false_type) {
+    return children;
+  }
+
+  static std::uint32_t children_handle(Siblings* children, std::true_type) {
+    return children == nullptr ? 0 : children->pool_index_;
+  }
+
+  Children_handle children_;
 };
 
 /* @} */  // end addtogroup simplex_tree
@@ -15,6 +15,7 @@
 
 #include <boost/container/flat_map.hpp>
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -42,30 +43,35 @@ class Simplex_tree_siblings {
   typedef typename SimplexTree::Node Node;
   typedef MapContainer Dictionary;
   typedef typename MapContainer::iterator Dictionary_it;
+  typedef typename MapContainer::allocator_type Allocator;
 
   /* Default constructor.*/
   Simplex_tree_siblings()
       : oncles_(nullptr),
         parent_(-1),
+        pool_index_(0),
         members_() {
   }
 
   /* Constructor with values.*/
-  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent)
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const Allocator& alloc = Allocator())
       : oncles_(oncles),
         parent_(parent),
-        members_() {
+        pool_index_(0),
+        members_(alloc) {
   }
 
   /* \brief Constructor with initialized set of members.
    *
    * 'members' must be sorted and unique.*/
   template<typename RandomAccessVertexRange>
-  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const RandomAccessVertexRange & members)
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const RandomAccessVertexRange & members,
+                        const Allocator& alloc = Allocator())
       : oncles_(oncles),
         parent_(parent),
+        pool_index_(0),
         members_(boost::container::ordered_unique_range, members.begin(),
-                 members.end()) {
+                 members.end(), alloc) {
     for (auto& map_el : members_) {
       map_el.second.assign_children(this);
     }
@@ -100,6 +106,10 @@ class Simplex_tree_siblings {
     return members_;
   }
 
+  const Dictionary & members() const {
+    return members_;
+  }
+
   size_t size() const {
     return members_.size();
   }
@@ -110,6 +120,8 @@ class Simplex_tree_siblings {
 
   Simplex_tree_siblings * oncles_;
   Vertex_handle parent_;
+  // Index in the table of siblings of the tree, if SimplexTreeOptions::packed_nodes
+  std::uint32_t pool_index_;
   Dictionary members_;
 };
 
@@ -0,0 +1,160 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_SIBLINGS_POOL_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_SIBLINGS_POOL_H_
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/spin_mutex.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>  // for std::unique_ptr
+#include <stdexcept>  // for std::length_error
+#include <utility>  // for std::swap
+#include <vector>
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/* \private
+ * Table of the Simplex_tree_siblings of a Simplex_tree with SimplexTreeOptions::packed_nodes, which lets the nodes
+ * refer to their children with a 32 bits index. The root is at index 0.
+ *
+ * The pointers are stored in segments of sizes 1, 2, 4, ... that never move, so that reading an index is safe while
+ * other threads add siblings, as during a parallel expansion. The indices of the removed siblings are reused.
+ */
+template <class Siblings>
+class Simplex_tree_siblings_pool {
+ public:
+  typedef std::uint32_t Index;
+
+  explicit Simplex_tree_siblings_pool(Siblings* root) {
+    reset(root);
+  }
+
+  Simplex_tree_siblings_pool(const Simplex_tree_siblings_pool&) = delete;
+  Simplex_tree_siblings_pool& operator=(const Simplex_tree_siblings_pool&) = delete;
+
+  Siblings* operator[](Index index) const {
+    std::size_t position = static_cast<std::size_t>(index) + 1;
+    int segment = highest_bit(position);
+    return segments_[segment][position - (std::size_t(1) << segment)];
+  }
+
+  /* Registers sib and returns its index. */
+  Index add(Siblings* sib) {
+#ifdef GUDHI_USE_TBB
+    tbb::spin_mutex::scoped_lock lock(mutex_);
+#endif
+    Index index;
+    if (!free_.empty()) {
+      index = free_.back();
+      free_.pop_back();
+    } else {
+      if (size_ == max_size)
+        throw std::length_error("Simplex_tree - more siblings than a packed node can index");
+      index = static_cast<Index>(size_++);
+      std::size_t position = static_cast<std::size_t>(index) + 1;
+      int segment = highest_bit(position);
+      if (position == (std::size_t(1) << segment))
+        segments_[segment].reset(new Siblings*[position]);
+    }
+    set(index, sib);
+    return index;
+  }
+
+  /* Makes the index of removed siblings available again. */
+  void remove(Index index) {
+#ifdef GUDHI_USE_TBB
+    tbb::spin_mutex::scoped_lock lock(mutex_);
+#endif
+    free_.push_back(index);
+  }
+
+  /* Forgets all the siblings but the root, and gives the memory back. */
+  void reset(Siblings* root) {
+    for (int segment = 1; segment < num_segments; ++segment)
+      segments_[segment].reset();
+    std::vector<Index>().swap(free_);
+    if (!segments_[0]) segments_[0].reset(new Siblings*[1]);
+    segments_[0][0] = root;
+    size_ = 1;
+  }
+
+  /* Exchanges the siblings, but not the roots: the roots of both pools must then be set again. */
+  void swap(Simplex_tree_siblings_pool& other) {
+    for (int segment = 0; segment < num_segments; ++segment)
+      segments_[segment].swap(other.segments_[segment]);
+    free_.swap(other.free_);
+    std::swap(size_, other.size_);
+  }
+
+  void set_root(Siblings* root) {
+    set(0, root);
+  }
+
+  /* Memory allocated for the table. */
+  std::size_t memory_usage() const {
+    std::size_t bytes = free_.capacity() * sizeof(Index);
+    for (int segment = 0; segment < num_segments && segments_[segment]; ++segment)
+      bytes += (std::size_t(1) << segment) * sizeof(Siblings*);
+    return bytes;
+  }
+
+ private:
+  static const int num_segments = 32;
+  // The largest index is reserved so that positions fit in the segments.
+  static const std::uint64_t max_size = (std::uint64_t(1) << num_segments) - 1;
+
+  static int highest_bit(std::size_t position) {
+#if defined(__GNUC__)
+    return static_cast<int>(sizeof(unsigned long long) * 8 - 1) - __builtin_clzll(position);
+#else
+    int bit = 0;
+    while (position >>= 1) ++bit;
+    return bit;
+#endif
+  }
+
+  void set(Index index, Siblings* sib) {
+    std::size_t position = static_cast<std::size_t>(index) + 1;
+    int segment = highest_bit(position);
+    segments_[segment][position - (std::size_t(1) << segment)] = sib;
+  }
+
+  std::unique_ptr<Siblings*[]> segments_[num_segments];
+  std::vector<Index> free_;
+  std::uint64_t size_;
+#ifdef GUDHI_USE_TBB
+  tbb::spin_mutex mutex_;
+#endif
+};
+
+/* \private
+ * Placeholder for the table of siblings when the nodes point directly to their children. */
+template <class Siblings>
+struct Simplex_tree_no_siblings_pool {
+  explicit Simplex_tree_no_siblings_pool(Siblings*) {}
+  void reset(Siblings*) {}
+  std::uint32_t add(Siblings*) { return 0; }
+  void remove(std::uint32_t) {}
+  void swap(Simplex_tree_no_siblings_pool&) {}
+  void set_root(Siblings*) {}
+  std::size_t memory_usage() const { return 0; }
+};
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_SIBLINGS_POOL_H_
@@ -0,0 +1,97 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_HOOKS_SIMPLEX_BASE_H_
+#define SIMPLEX_TREE_HOOKS_SIMPLEX_BASE_H_
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/** \private
+ * Empty base of the nodes, when they are not linked.
+ */
+struct Hooks_simplex_base_dummy {
+};
+
+/** \private
+ * Hook of a node in a circular doubly linked list, used to link all the nodes with the same label.
+ *
+ * The list is headed by a hook that is not part of a node. An unlinked hook points to itself. As nodes are stored in
+ * a `boost::container::flat_map`, they are moved around by insertions and deletions in their `Simplex_tree_siblings`:
+ * a moved hook takes the place of its source in the list, and a destroyed hook removes itself from the list. A copy
+ * is unlinked.
+ */
+class Hooks_simplex_base_link_nodes {
+ public:
+  Hooks_simplex_base_link_nodes() noexcept : prev_(this), next_(this) {}
+
+  Hooks_simplex_base_link_nodes(const Hooks_simplex_base_link_nodes&) noexcept : prev_(this), next_(this) {}
+
+  Hooks_simplex_base_link_nodes(Hooks_simplex_base_link_nodes&& other) noexcept : prev_(this), next_(this) {
+    take_place_of(other);
+  }
+
+  Hooks_simplex_base_link_nodes& operator=(const Hooks_simplex_base_link_nodes&) noexcept {
+    unlink();
+    return *this;
+  }
+
+  Hooks_simplex_base_link_nodes& operator=(Hooks_simplex_base_link_nodes&& other) noexcept {
+    if (&other != this) {
+      unlink();
+      take_place_of(other);
+    }
+    return *this;
+  }
+
+  ~Hooks_simplex_base_link_nodes() { unlink(); }
+
+  bool is_linked() const { return next_ != this; }
+
+  /* Inserts this unlinked hook right after position. */
+  void link_after(Hooks_simplex_base_link_nodes& position) {
+    prev_ = &position;
+    next_ = position.next_;
+    position.next_->prev_ = this;
+    position.next_ = this;
+  }
+
+  void unlink() {
+    prev_->next_ = next_;
+    next_->prev_ = prev_;
+    prev_ = next_ = this;
+  }
+
+  /* Empties the list headed by this hook without touching its elements, e.g. when they are deallocated without
+   * being destroyed. */
+  void forget_list() { prev_ = next_ = this; }
+
+  Hooks_simplex_base_link_nodes* next() const { return next_; }
+
+ private:
+  void take_place_of(Hooks_simplex_base_link_nodes& other) {
+    if (!other.is_linked()) return;
+    prev_ = other.prev_;
+    next_ = other.next_;
+    prev_->next_ = this;
+    next_->prev_ = this;
+    other.prev_ = other.next_ = &other;
+  }
+
+  Hooks_simplex_base_link_nodes* prev_;
+  Hooks_simplex_base_link_nodes* next_;
+};
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_HOOKS_SIMPLEX_BASE_H_
@@ -0,0 +1,49 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+#define SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+
+#include <cstddef>
+#include <cstring>  // for memcpy
+#include <stdexcept>
+#include <type_traits>
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/** \private
+ * Writes value at start, in the native binary representation, and returns the position after it.
+ */
+template <class ArgumentType>
+char* serialize_trivial(ArgumentType value, char* start) {
+  static_assert(std::is_trivially_copyable<ArgumentType>::value, "Only trivially copyable types can be serialized");
+  std::memcpy(start, &value, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+/** \private
+ * Reads value at start, and returns the position after it. Throws std::invalid_argument if this goes beyond end.
+ */
+template <class ArgumentType>
+const char* deserialize_trivial(ArgumentType& value, const char* start, const char* end) {
+  static_assert(std::is_trivially_copyable<ArgumentType>::value, "Only trivially copyable types can be deserialized");
+  if (end - start < static_cast<std::ptrdiff_t>(sizeof(ArgumentType)))
+    throw std::invalid_argument("Buffer is too small to be deserialized");
+  std::memcpy(&value, start, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SERIALIZATION_UTILS_H_
@@ -0,0 +1,243 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_VIEW_H_
+#define SIMPLEX_TREE_VIEW_H_
+
+#include <gudhi/Debug_utils.h>
+
+#include <boost/iterator/filter_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>  // for pair
+#include <vector>
+
+namespace Gudhi {
+
+/** \brief Filtered subcomplex of a `Simplex_tree`, made of its simplices of filtration value at most a threshold
+ * and, optionally, of dimension at most a maximal dimension, without copying the tree.
+ *
+ * \implements FilteredComplex
+ * \ingroup simplex_tree
+ *
+ * The view reads the nodes and the filtration order of the tree, which must outlive it and must not be modified
+ * while it is used. The sublevel set of the threshold is a prefix of the filtration of the tree: when all the
+ * dimensions are kept, the view only stores the length of this prefix, and the keys of the tree are the keys of the
+ * view. When the dimension is restricted, the view stores its own filtration order and its own keys, i.e. one
+ * `Simplex_handle` and one `Simplex_key` per simplex of the prefix.
+ *
+ * `assign_key` never writes in the tree, so that several views of the same tree, e.g. with different thresholds, can
+ * be given to the persistence at the same time, from different threads.
+ *
+ * \tparam SimplexTree A `Simplex_tree` whose SimplexTreeOptions::store_key is true.
+ */
+template <class SimplexTree>
+class Simplex_tree_view {
+ public:
+  typedef typename SimplexTree::Simplex_handle Simplex_handle;
+  typedef typename SimplexTree::Simplex_key Simplex_key;
+  typedef typename SimplexTree::Filtration_value Filtration_value;
+  typedef typename SimplexTree::Vertex_handle Vertex_handle;
+  typedef typename SimplexTree::Indexing_tag Indexing_tag;
+
+  typedef typename std::vector<Simplex_handle>::const_iterator Filtration_simplex_iterator;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
+
+  typedef typename SimplexTree::Boundary_simplex_iterator Boundary_simplex_iterator;
+  typedef typename SimplexTree::Boundary_simplex_range Boundary_simplex_range;
+
+  typedef typename SimplexTree::Simplex_vertex_iterator Simplex_vertex_iterator;
+  typedef typename SimplexTree::Simplex_vertex_range Simplex_vertex_range;
+
+  typedef typename SimplexTree::Boundary_keys_range Boundary_keys_range;
+
+ private:
+  struct Is_in_view {
+    bool operator()(Simplex_handle sh) const { return view_->contains(sh); }
+    const Simplex_tree_view* view_;
+  };
+
+ public:
+  typedef boost::filter_iterator<Is_in_view, typename SimplexTree::Skeleton_simplex_iterator>
+      Skeleton_simplex_iterator;
+  typedef boost::iterator_range<Skeleton_simplex_iterator> Skeleton_simplex_range;
+
+  /** \brief Builds the view of the simplices of `st` of filtration value at most `threshold` and of dimension at most
+   * `max_dim`.
+   *
+   * The filtration of `st` must be valid, and the keys of its simplices must be their positions in the filtration,
+   * as after `Simplex_tree::update_filtration()` or `Simplex_tree::initialize_boundary_keys()`. Building views does
+   * not modify `st` once its filtration is initialized.
+   *
+   * @exception std::invalid_argument If the keys of `st` are not the positions in its filtration.
+   */
+  Simplex_tree_view(SimplexTree& st, Filtration_value threshold, int max_dim = std::numeric_limits<int>::max())
+      : st_(&st),
+        tree_order_(&st.filtration_simplex_range()),
+        threshold_(threshold),
+        dimension_(-1) {
+    auto end = std::upper_bound(tree_order_->begin(), tree_order_->end(), threshold,
+                                [](Filtration_value f, Simplex_handle sh) { return f < SimplexTree::filtration(sh); });
+    prefix_size_ = static_cast<std::size_t>(end - tree_order_->begin());
+    // Only the first and the last simplices of the prefix are checked, which catches the keys that were never
+    // assigned or that were assigned in another order.
+    if (prefix_size_ > 0 &&
+        (SimplexTree::key(tree_order_->front()) != 0 ||
+         SimplexTree::key((*tree_order_)[prefix_size_ - 1]) != static_cast<Simplex_key>(prefix_size_ - 1)))
+      throw std::invalid_argument("Simplex_tree_view - the keys are not the positions in the filtration");
+    GUDHI_CHECK(std::all_of(tree_order_->begin(), end, [&](const Simplex_handle& sh) {
+                  return SimplexTree::key(sh) == static_cast<Simplex_key>(&sh - &tree_order_->front());
+                }), std::invalid_argument("Simplex_tree_view - the keys are not the positions in the filtration"));
+
+    const int dim_bound = std::min(max_dim, st.dimension());
+    if (max_dim >= st.dimension()) {
+      // The dimension of the prefix, the scan stops at the first simplex of the dimension of the tree.
+      for (auto it = tree_order_->begin(); it != end && dimension_ < dim_bound; ++it)
+        dimension_ = std::max(dimension_, st.dimension(*it));
+      return;
+    }
+    keys_.assign(prefix_size_, null_key());
+    for (std::size_t i = 0; i < prefix_size_; ++i) {
+      Simplex_handle sh = (*tree_order_)[i];
+      int dim = st.dimension(sh);
+      if (dim <= max_dim) {
+        keys_[i] = static_cast<Simplex_key>(simplices_.size());
+        simplices_.push_back(sh);
+        dimension_ = std::max(dimension_, dim);
+      }
+    }
+  }
+
+  /** \brief Returns the tree the view reads. */
+  SimplexTree& simplex_tree() const {
+    return *st_;
+  }
+
+  /** \brief Returns the threshold on the filtration values. */
+  Filtration_value threshold() const {
+    return threshold_;
+  }
+
+  /** \brief Returns whether a simplex of the tree belongs to the view. */
+  bool contains(Simplex_handle sh) const {
+    Simplex_key k = SimplexTree::key(sh);
+    if (k == null_key() || static_cast<std::size_t>(k) >= prefix_size_) return false;
+    return keys_.empty() || keys_[k] != null_key();
+  }
+
+  /** \brief Returns the number of simplices in the view. */
+  std::size_t num_simplices() const {
+    return own_order() ? simplices_.size() : prefix_size_;
+  }
+
+  /** \brief Returns the dimension of the view, -1 if it is empty. */
+  int dimension() const {
+    return dimension_;
+  }
+
+  int dimension(Simplex_handle sh) const {
+    return st_->dimension(sh);
+  }
+
+  /** \brief Returns the filtration value of a simplex.
+   *
+   * Called on the null_simplex, it returns infinity. */
+  static Filtration_value filtration(Simplex_handle sh) {
+    return SimplexTree::filtration(sh);
+  }
+
+  /** \brief Returns the position of a simplex of the view in its filtration. */
+  Simplex_key key(Simplex_handle sh) const {
+    Simplex_key k = SimplexTree::key(sh);
+    return own_order() ? keys_[k] : k;
+  }
+
+  /** \brief Only checks that `k` is the position of `sh` in the filtration of the view, which is the key that the
+   * persistence assigns: the keys are never modified. */
+  void assign_key(Simplex_handle sh, Simplex_key k) const {
+    GUDHI_CHECK(key(sh) == k, std::invalid_argument("Simplex_tree_view::assign_key - keys cannot be modified"));
+    (void)sh;
+    (void)k;
+  }
+
+  static Simplex_key null_key() {
+    return SimplexTree::null_key();
+  }
+
+  static Simplex_handle null_simplex() {
+    return SimplexTree::null_simplex();
+  }
+
+  /** \brief Returns the simplex at position idx in the filtration of the view. */
+  Simplex_handle simplex(Simplex_key idx) const {
+    return own_order() ? simplices_[idx] : (*tree_order_)[idx];
+  }
+
+  /** \brief Returns a range over the simplices of the view, in the order of the filtration of the tree. */
+  Filtration_simplex_range filtration_simplex_range(Indexing_tag = Indexing_tag()) const {
+    if (own_order()) return Filtration_simplex_range(simplices_.begin(), simplices_.end());
+    return Filtration_simplex_range(tree_order_->begin(), tree_order_->begin() + prefix_size_);
+  }
+
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) const {
+    return st_->boundary_simplex_range(sh);
+  }
+
+  Simplex_vertex_range simplex_vertex_range(Simplex_handle sh) const {
+    return st_->simplex_vertex_range(sh);
+  }
+
+  /** \brief Returns a range over the simplices of the view of dimension at most dim. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim) const {
+    auto range = st_->skeleton_simplex_range(dim);
+    Is_in_view is_in_view{this};
+    return Skeleton_simplex_range(Skeleton_simplex_iterator(is_in_view, range.begin(), range.end()),
+                                  Skeleton_simplex_iterator(is_in_view, range.end(), range.end()));
+  }
+
+  std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) const {
+    return st_->endpoints(sh);
+  }
+
+  /** \brief Returns whether `boundary_keys` can be called, i.e. whether all the dimensions are kept and the tree
+   * stores the keys of the boundaries. */
+  bool has_boundary_keys() const {
+    return !own_order() && st_->has_boundary_keys();
+  }
+
+  /** \brief Returns the keys of the facets of the simplex of key `k`, as stored by the tree. */
+  Boundary_keys_range boundary_keys(Simplex_key k) const {
+    return st_->boundary_keys(k);
+  }
+
+ private:
+  bool own_order() const {
+    return !keys_.empty();
+  }
+
+  SimplexTree* st_;
+  const std::vector<Simplex_handle>* tree_order_;
+  Filtration_value threshold_;
+  // Length of the prefix of the filtration of the tree below the threshold.
+  std::size_t prefix_size_;
+  int dimension_;
+  // When the dimension is restricted: the simplices of the view in filtration order, and the key in the view of the
+  // simplex of key k in the tree, null_key() if it is not in the view. Both empty otherwise.
+  std::vector<Simplex_handle> simplices_;
+  std::vector<Simplex_key> keys_;
+};
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_VIEW_H_
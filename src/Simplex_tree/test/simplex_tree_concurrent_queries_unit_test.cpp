@@ -0,0 +1,156 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_concurrent_queries"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <gudhi/Simplex_tree.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+using namespace Gudhi;
+
+struct Simplex_tree_options_link_nodes : Simplex_tree_options_full_featured {
+  static const bool link_nodes_by_label = true;
+};
+
+struct Simplex_tree_options_packed : Simplex_tree_options_full_featured {
+  static const bool packed_nodes = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_link_nodes>,
+                         Simplex_tree<Simplex_tree_options_packed>> list_of_tested_variants;
+
+// Random flag complex of dimension 4 on contiguous vertices, with a dimension to be lowered after the removal of a
+// maximal simplex.
+template<class Stree>
+void build_test_complex(Stree& st) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> filtration(0., 1.);
+  for (int u = 0; u < 50; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = u + 1; v < 50; ++v)
+      if (filtration(gen) < 0.4)
+        st.insert_simplex({u, v}, filtration(gen));
+  }
+  st.expansion(4);
+  st.insert_simplex_and_subfaces({50, 51, 52, 53, 54, 55}, 2.);
+  st.remove_maximal_simplex(st.find({50, 51, 52, 53, 54, 55}));
+}
+
+// Answers that do not depend on the order of the cofaces.
+template<class Stree>
+struct Answer {
+  Answer(Stree& st, typename Stree::Simplex_handle sh)
+      : filtration(st.filtration(sh)),
+        dimension(st.dimension(sh)),
+        num_cofaces(st.cofaces_simplex_range(sh, 1).size()),
+        num_star(st.star_simplex_range(sh).size()),
+        num_facets(0) {
+    for (auto b_sh : st.boundary_simplex_range(sh)) {
+      if (st.dimension(b_sh) + 1 == dimension) ++num_facets;
+    }
+  }
+
+  bool operator==(const Answer& other) const {
+    return filtration == other.filtration && dimension == other.dimension && num_cofaces == other.num_cofaces &&
+           num_star == other.num_star && num_facets == other.num_facets;
+  }
+
+  double filtration;
+  int dimension;
+  std::size_t num_cofaces;
+  std::size_t num_star;
+  int num_facets;
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_seal, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  BOOST_CHECK(st.upper_bound_dimension() == 5);
+  st.seal();
+  // The dimension is lowered and the filtration initialized, the queries have nothing left to compute
+  BOOST_CHECK(st.upper_bound_dimension() == 4);
+  BOOST_CHECK(st.dimension() == 4);
+  BOOST_CHECK(st.filtration_simplex_range().size() == st.num_simplices());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_concurrent_queries, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  st.seal();
+
+  std::vector<std::vector<int>> simplices;
+  std::vector<Answer<typeST>> answers;
+  for (auto sh : st.complex_simplex_range()) {
+    simplices.emplace_back(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    answers.emplace_back(st, sh);
+  }
+  const std::size_t num_simplices = st.num_simplices();
+  std::size_t num_edges = 0;
+  for (auto sh : st.skeleton_simplex_range(1)) {
+    if (st.dimension(sh) == 1) ++num_edges;
+  }
+  std::cout << "simplex_tree_concurrent_queries - " << num_simplices << " simplices\n";
+  BOOST_CHECK(simplices.size() == num_simplices);
+
+  // Each query looks a simplex up by its vertices, given in a random order, and checks the answers.
+  std::atomic<std::size_t> num_errors(0);
+  const std::size_t num_queries = 20000;
+  auto query = [&](std::size_t i) {
+    std::size_t idx = (i * 7919) % simplices.size();
+    std::vector<int> vertices = simplices[idx];
+    std::shuffle(vertices.begin(), vertices.end(), std::mt19937(static_cast<unsigned>(i)));
+    auto sh = st.find(vertices);
+    if (sh == st.null_simplex() || !(Answer<typeST>(st, sh) == answers[idx]))
+      ++num_errors;
+    if (st.find(std::vector<int>{static_cast<int>(i % 50), 200}) != st.null_simplex())
+      ++num_errors;
+    if (i % 500 == 0) {
+      // Whole traversals, concurrent with the other queries
+      if (st.num_simplices() != num_simplices || st.dimension() != 4)
+        ++num_errors;
+      std::size_t count = 0;
+      typename typeST::Filtration_value previous = 0.;
+      for (auto f_sh : st.filtration_simplex_range()) {
+        if (st.filtration(f_sh) < previous) ++num_errors;
+        previous = st.filtration(f_sh);
+        ++count;
+      }
+      std::size_t edges = 0;
+      for (auto s_sh : st.skeleton_simplex_range(1)) {
+        if (st.dimension(s_sh) == 1) ++edges;
+      }
+      if (count != num_simplices || edges != num_edges)
+        ++num_errors;
+    }
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), num_queries, query);
+#else
+  for (std::size_t i = 0; i < num_queries; ++i)
+    query(i);
+#endif
+  BOOST_CHECK(num_errors == 0);
+  // The queries did not modify the tree
+  BOOST_CHECK(st.num_simplices() == num_simplices);
+  BOOST_CHECK(st.upper_bound_dimension() == 4);
+}
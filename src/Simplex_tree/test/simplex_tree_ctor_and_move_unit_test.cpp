@@ -23,7 +23,23 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+struct Simplex_tree_options_link_nodes : Simplex_tree_options_full_featured {
+  static const bool link_nodes_by_label = true;
+};
+
+struct Simplex_tree_options_packed : Simplex_tree_options_full_featured {
+  static const bool packed_nodes = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>,
+                         Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_link_nodes>,
+                         Simplex_tree<Simplex_tree_options_packed>> list_of_tested_variants;
 
 template<typename Simplex_tree>
 void print_simplex_filtration(Simplex_tree& st, const std::string& msg) {
@@ -0,0 +1,148 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <algorithm>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_flat_filtered_complex"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Flat_filtered_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+
+using namespace Gudhi;
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+
+template<class Stree>
+void build_test_complex(Stree& st) {
+  st.insert_simplex({0, 1}, 0.);
+  st.insert_simplex({0, 2}, 1.);
+  st.insert_simplex({0, 3}, 2.);
+  st.insert_simplex({1, 2}, 3.);
+  st.insert_simplex({1, 3}, 4.);
+  st.insert_simplex({2, 3}, 5.);
+  st.insert_simplex({2, 4}, 6.);
+  st.insert_simplex({3, 6}, 7.);
+  st.insert_simplex({4, 5}, 8.);
+  st.insert_simplex({4, 6}, 9.);
+  st.insert_simplex({5, 6}, 10.);
+  st.insert_simplex({6}, 10.);
+  st.insert_simplex({7}, 11.);
+  st.expansion(3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(flat_filtered_complex_structure, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  Flat_filtered_complex<typename typeST::Filtration_value> flat(st);
+
+  BOOST_CHECK(flat.num_simplices() == st.num_simplices());
+  BOOST_CHECK(flat.num_vertices() == st.num_vertices());
+  BOOST_CHECK(flat.dimension() == st.dimension());
+
+  std::size_t idx = 0;
+  for (auto sh : st.filtration_simplex_range()) {
+    auto fsh = flat.simplex(idx);
+    BOOST_CHECK(st.key(sh) == idx);
+    BOOST_CHECK(flat.key(fsh) == idx);
+    BOOST_CHECK(flat.filtration(fsh) == st.filtration(sh));
+    BOOST_CHECK(flat.dimension(fsh) == st.dimension(sh));
+    std::vector<int> st_vertices(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    std::vector<int> flat_vertices(flat.simplex_vertex_range(fsh).begin(), flat.simplex_vertex_range(fsh).end());
+    BOOST_CHECK(st_vertices == flat_vertices);
+    std::vector<std::size_t> st_boundary;
+    for (auto b_sh : st.boundary_simplex_range(sh))
+      st_boundary.push_back(st.key(b_sh));
+    std::vector<std::size_t> flat_boundary(flat.boundary_simplex_range(fsh).begin(),
+                                           flat.boundary_simplex_range(fsh).end());
+    BOOST_CHECK(st_boundary == flat_boundary);
+    ++idx;
+  }
+  BOOST_CHECK(flat.filtration(flat.null_simplex()) == std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(flat_filtered_complex_persistence, typeST, list_of_tested_variants) {
+  using Flat = Flat_filtered_complex<typename typeST::Filtration_value>;
+  using Field_Zp = persistent_cohomology::Field_Zp;
+  Flat flat;
+  std::vector<std::tuple<int, double, double>> st_intervals;
+  {
+    typeST st;
+    build_test_complex(st);
+
+    persistent_cohomology::Persistent_cohomology<typeST, Field_Zp> st_pcoh(st);
+    st_pcoh.init_coefficients(2);
+    st_pcoh.compute_persistent_cohomology();
+    for (auto pair : st_pcoh.get_persistent_pairs())
+      st_intervals.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)),
+                                st.filtration(std::get<1>(pair)));
+    flat = Flat(st);
+  }
+  // The snapshot does not need the tree anymore
+  persistent_cohomology::Persistent_cohomology<Flat, Field_Zp> flat_pcoh(flat);
+  flat_pcoh.init_coefficients(2);
+  flat_pcoh.compute_persistent_cohomology();
+  std::vector<std::tuple<int, double, double>> flat_intervals;
+  for (auto pair : flat_pcoh.get_persistent_pairs())
+    flat_intervals.emplace_back(flat.dimension(std::get<0>(pair)), flat.filtration(std::get<0>(pair)),
+                                flat.filtration(std::get<1>(pair)));
+
+  std::sort(st_intervals.begin(), st_intervals.end());
+  std::sort(flat_intervals.begin(), flat_intervals.end());
+  std::cout << "flat_filtered_complex_persistence - " << flat_intervals.size() << " intervals\n";
+  BOOST_CHECK(st_intervals == flat_intervals);
+  BOOST_CHECK(flat_pcoh.betti_number(0) == 2);
+  BOOST_CHECK(flat_pcoh.betti_number(1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(flat_filtered_complex_serialization) {
+  using Flat = Flat_filtered_complex<>;
+  Simplex_tree<> st;
+  build_test_complex(st);
+  Flat flat(st);
+
+  // std::uint64_t ensures the alignment, as a memory-mapped file would
+  std::size_t buffer_size = flat.get_serialization_size();
+  std::vector<std::uint64_t> buffer((buffer_size + 7) / 8);
+  const char* data = reinterpret_cast<const char*>(buffer.data());
+  flat.serialize(reinterpret_cast<char*>(buffer.data()), buffer_size);
+  std::cout << "flat_filtered_complex_serialization - " << buffer_size << " bytes\n";
+
+  Flat view(data, buffer_size);
+  BOOST_CHECK(view.num_simplices() == flat.num_simplices());
+  BOOST_CHECK(view.num_vertices() == flat.num_vertices());
+  BOOST_CHECK(view.dimension() == flat.dimension());
+  for (auto sh : flat.filtration_simplex_range()) {
+    BOOST_CHECK(view.filtration(sh) == flat.filtration(sh));
+    BOOST_CHECK(view.key(sh) == flat.key(sh));
+    BOOST_CHECK(std::equal(view.simplex_vertex_range(sh).begin(), view.simplex_vertex_range(sh).end(),
+                           flat.simplex_vertex_range(sh).begin()));
+    BOOST_CHECK(std::equal(view.boundary_simplex_range(sh).begin(), view.boundary_simplex_range(sh).end(),
+                           flat.boundary_simplex_range(sh).begin()));
+  }
+  // The view only stores the keys
+  Flat view_copy(view);
+  persistent_cohomology::Persistent_cohomology<Flat, persistent_cohomology::Field_Zp> pcoh(view_copy);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  BOOST_CHECK(pcoh.betti_number(0) == 2);
+  BOOST_CHECK(pcoh.betti_number(1) == 1);
+
+  BOOST_CHECK_THROW(Flat(data, buffer_size - 1), std::invalid_argument);
+  BOOST_CHECK_THROW(Flat(data + 1, buffer_size - 1), std::invalid_argument);
+  using Flat_float = Flat_filtered_complex<float>;
+  BOOST_CHECK_THROW(Flat_float(data, buffer_size), std::invalid_argument);
+}
@@ -16,6 +16,10 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <functional> // greater
+#include <random>
+#include <vector>
+#include <iterator>  // std::back_inserter
+#include <cstdint>  // std::int64_t
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -28,7 +32,23 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+struct Simplex_tree_options_link_nodes : Simplex_tree_options_full_featured {
+  static const bool link_nodes_by_label = true;
+};
+
+struct Simplex_tree_options_packed : Simplex_tree_options_full_featured {
+  static const bool packed_nodes = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>,
+                         Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_link_nodes>,
+                         Simplex_tree<Simplex_tree_options_packed>> list_of_tested_variants;
 
 
 bool AreAlmostTheSame(float a, float b) {
@@ -243,3 +263,113 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_2, typeST, list_of_tested_v
   BOOST_CHECK(AreAlmostTheSame(simplex_tree.filtration(simplex_tree.find({1,2,3})), 5.));
   BOOST_CHECK(simplex_tree.find({0,1,2,3}) == simplex_tree.null_simplex());
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_parallel_expansion_with_blockers, typeST, list_of_tested_variants) {
+  using Simplex_handle = typename typeST::Simplex_handle;
+  // 1-skeleton graph example, with a 5-clique {0, 1, 2, 3, 7}
+  typeST stree_graph;
+  stree_graph.insert_simplex({0, 1}, 0.);
+  stree_graph.insert_simplex({0, 2}, 1.);
+  stree_graph.insert_simplex({0, 3}, 2.);
+  stree_graph.insert_simplex({1, 2}, 3.);
+  stree_graph.insert_simplex({1, 3}, 4.);
+  stree_graph.insert_simplex({2, 3}, 5.);
+  stree_graph.insert_simplex({2, 4}, 6.);
+  stree_graph.insert_simplex({3, 6}, 7.);
+  stree_graph.insert_simplex({4, 5}, 8.);
+  stree_graph.insert_simplex({4, 6}, 9.);
+  stree_graph.insert_simplex({5, 6}, 10.);
+  stree_graph.insert_simplex({6}, 10.);
+  for (auto v : {0, 1, 2, 3})
+    stree_graph.insert_simplex({v, 7}, 11. + v);
+
+  for (int max_dim = 1; max_dim < 6; max_dim++) {
+    typeST stree(stree_graph);
+    typeST stree_parallel(stree_graph);
+    auto blocker = [](typeST& st, Simplex_handle sh) {
+      bool result = false;
+      for (auto vertex : st.simplex_vertex_range(sh)) {
+        // We block the expansion, if the vertex '6' is in the given list of vertices
+        if (vertex == 6)
+          result = true;
+      }
+      st.assign_filtration(sh, st.filtration(sh) + 1.);
+      return result;
+    };
+    stree.expansion_with_blockers(max_dim, [&](Simplex_handle sh) { return blocker(stree, sh); });
+    stree_parallel.parallel_expansion_with_blockers(max_dim, [&](Simplex_handle sh) {
+      return blocker(stree_parallel, sh);
+    });
+
+    std::cout << "simplex_tree_parallel_expansion_with_blockers - max_dim = " << max_dim << " - "
+              << stree_parallel.num_simplices() << " simplices - dimension " << stree_parallel.dimension() << "\n";
+    BOOST_CHECK(stree == stree_parallel);
+    BOOST_CHECK(stree.dimension() == stree_parallel.dimension());
+    BOOST_CHECK(stree_parallel.dimension() == (std::min)(max_dim, 4));
+  }
+}
+
+template <typename Vertex>
+void check_sorted_intersection(std::mt19937& gen, std::size_t max_size, Vertex max_vertex) {
+  std::uniform_int_distribution<std::size_t> size_dist(0, max_size);
+  std::uniform_int_distribution<Vertex> vertex_dist(-max_vertex, max_vertex);
+  auto random_set = [&]() {
+    std::vector<Vertex> set(size_dist(gen));
+    for (auto& vertex : set) vertex = vertex_dist(gen);
+    std::sort(set.begin(), set.end());
+    set.erase(std::unique(set.begin(), set.end()), set.end());
+    return set;
+  };
+  for (int i = 0; i < 200; ++i) {
+    std::vector<Vertex> first = random_set(), second = random_set(), expected, result;
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expected));
+    Gudhi::simplex_tree::intersect_sorted(first.data(), first.size(), second.data(), second.size(),
+                                          [&](std::size_t i, std::size_t j) {
+                                            BOOST_CHECK(first[i] == second[j]);
+                                            result.push_back(first[i]);
+                                          });
+    BOOST_CHECK(result == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(simplex_tree_sorted_intersection) {
+  std::mt19937 gen(17);
+  // Small sets for the remainders of the blocks, dense and sparse intersections
+  check_sorted_intersection<int>(gen, 20, 15);
+  check_sorted_intersection<int>(gen, 200, 150);
+  check_sorted_intersection<int>(gen, 200, 10000);
+  // The scalar version
+  check_sorted_intersection<std::int64_t>(gen, 200, 150);
+  check_sorted_intersection<short>(gen, 200, 150);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_of_dense_graph, typeST, list_of_tested_variants) {
+  using Simplex_handle = typename typeST::Simplex_handle;
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  // A dense random graph, with non contiguous vertices when possible
+  const int step = typeST::Options::contiguous_vertices ? 1 : 3;
+  typeST stree;
+  for (int u = 0; u < 40; ++u) {
+    stree.insert_simplex({step * u}, 0.);
+    for (int v = 0; v < u; ++v) {
+      double filtration = dist(gen);
+      if (filtration < 0.6) stree.insert_simplex({step * v, step * u}, filtration);
+    }
+  }
+  typeST stree_with_blockers(stree);
+  stree.expansion(4);
+  stree_with_blockers.expansion_with_blockers(4, [](Simplex_handle) { return false; });
+  std::cout << "simplex_tree_expansion_of_dense_graph - " << stree.num_simplices() << " simplices\n";
+  BOOST_CHECK(stree == stree_with_blockers);
+  BOOST_CHECK(stree.dimension() == 4);
+  for (auto sh : stree.complex_simplex_range()) {
+    // The filtration value of a simplex is the maximal one of its edges
+    typename typeST::Filtration_value expected = 0.;
+    std::vector<int> vertices(stree.simplex_vertex_range(sh).begin(), stree.simplex_vertex_range(sh).end());
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+      for (std::size_t j = 0; j < i; ++j)
+        expected = (std::max)(expected, stree.filtration(stree.find({vertices[i], vertices[j]})));
+    BOOST_CHECK(stree.filtration(sh) == expected);
+  }
+}
@@ -0,0 +1,118 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_serialization"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+//  ^
+// /!\ Nothing else from Simplex_tree shall be included to test includes are well defined.
+#include "gudhi/Simplex_tree.h"
+
+using namespace Gudhi;
+
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+struct Simplex_tree_options_no_filtration : Simplex_tree_options_full_featured {
+  static const bool store_filtration = false;
+};
+
+struct Simplex_tree_options_packed : Simplex_tree_options_full_featured {
+  static const bool packed_nodes = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>,
+                         Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_packed>> list_of_tested_variants;
+
+template<class Stree>
+void build_test_complex(Stree& st) {
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, 4.);
+  st.insert_simplex_and_subfaces({3, 4, 5}, 3.);
+  st.insert_simplex_and_subfaces({3, 0}, 2.);
+  st.insert_simplex_and_subfaces({2, 1, 0}, 3.);
+  st.insert_simplex_and_subfaces({8}, 1.);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_serialization, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  // Keys are not compared by operator==
+  std::size_t idx = 0;
+  for (auto sh : st.filtration_simplex_range())
+    st.assign_key(sh, idx++);
+
+  for (bool with_keys : {false, true}) {
+    std::size_t buffer_size = st.get_serialization_size(with_keys);
+    std::cout << "simplex_tree_serialization - with_keys = " << with_keys << " - " << buffer_size << " bytes\n";
+    std::vector<char> buffer(buffer_size);
+    st.serialize(buffer.data(), buffer_size, with_keys);
+
+    typeST st_copy;
+    st_copy.deserialize(buffer.data(), buffer_size);
+    BOOST_CHECK(st == st_copy);
+    BOOST_CHECK(st_copy.num_simplices() == st.num_simplices());
+    BOOST_CHECK(st_copy.dimension() == 3);
+    for (auto sh : st.complex_simplex_range()) {
+      std::vector<int> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+      auto sh_copy = st_copy.find(simplex);
+      BOOST_CHECK(sh_copy != st_copy.null_simplex());
+      BOOST_CHECK(st_copy.filtration(sh_copy) == st.filtration(sh));
+      if (with_keys)
+        BOOST_CHECK(st_copy.key(sh_copy) == st.key(sh));
+    }
+
+    // The tree must be empty
+    BOOST_CHECK_THROW(st_copy.deserialize(buffer.data(), buffer_size), std::invalid_argument);
+    // Truncated buffer, at any depth of the tree. The simplex tree is left empty, and can be deserialized again.
+    for (std::size_t truncated_size = 0; truncated_size < buffer_size; ++truncated_size) {
+      typeST st_truncated;
+      BOOST_CHECK_THROW(st_truncated.deserialize(buffer.data(), truncated_size), std::invalid_argument);
+      BOOST_CHECK(st_truncated.num_simplices() == 0);
+      BOOST_CHECK(st_truncated.dimension() == -1);
+      st_truncated.deserialize(buffer.data(), buffer_size);
+      BOOST_CHECK(st == st_truncated);
+    }
+    BOOST_CHECK_THROW(st.serialize(buffer.data(), buffer_size - 1, with_keys), std::invalid_argument);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(simplex_tree_serialization_without_filtration) {
+  Simplex_tree<> st;
+  build_test_complex(st);
+  std::vector<char> buffer(st.get_serialization_size());
+  st.serialize(buffer.data(), buffer.size());
+
+  // Filtration values are skipped
+  Simplex_tree<Simplex_tree_options_no_filtration> st_no_filtration;
+  st_no_filtration.deserialize(buffer.data(), buffer.size());
+  BOOST_CHECK(st_no_filtration.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st_no_filtration.find({0, 1, 6, 7}) != st_no_filtration.null_simplex());
+
+  std::vector<char> buffer_no_filtration(st_no_filtration.get_serialization_size());
+  BOOST_CHECK(buffer_no_filtration.size() < buffer.size());
+  st_no_filtration.serialize(buffer_no_filtration.data(), buffer_no_filtration.size());
+  Simplex_tree<> st_copy;
+  st_copy.deserialize(buffer_no_filtration.data(), buffer_no_filtration.size());
+  BOOST_CHECK(st_copy.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st_copy.filtration(st_copy.find({0, 1, 6, 7})) == 0.);
+
+  // Another Filtration_value type
+  Simplex_tree<Simplex_tree_options_fast_persistence> st_float;
+  BOOST_CHECK_THROW(st_float.deserialize(buffer.data(), buffer.size()), std::invalid_argument);
+}
@@ -29,7 +29,23 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+struct Simplex_tree_options_link_nodes : Simplex_tree_options_full_featured {
+  static const bool link_nodes_by_label = true;
+};
+
+struct Simplex_tree_options_packed : Simplex_tree_options_full_featured {
+  static const bool packed_nodes = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>,
+                         Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_link_nodes>,
+                         Simplex_tree<Simplex_tree_options_packed>> list_of_tested_variants;
 
 
 template<class typeST>
@@ -875,6 +891,59 @@ BOOST_AUTO_TEST_CASE(make_filtration_non_decreasing) {
   
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(copy_make_filtration_non_decreasing_and_prune, typeST, list_of_tested_variants) {
+  // These traversals run concurrently on the subtrees of the vertices with TBB
+  typeST st;
+  for (int u = 0; u < 40; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = u + 1; v < 40; ++v)
+      if ((u * 31 + v * 17) % 7 < 4)
+        st.insert_simplex({u, v}, 0.);
+  }
+  st.expansion(4);
+  // Arbitrary filtration values, decreasing from some faces to their cofaces. The vertices are kept at 0, so that they
+  // remain contiguous after the pruning.
+  std::vector<std::vector<int>> simplices;
+  int i = 0;
+  for (auto sh : st.complex_simplex_range()) {
+    simplices.emplace_back(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    if (simplices.back().size() > 1)
+      st.assign_filtration(sh, static_cast<typename typeST::Filtration_value>((i++ * 7919) % 1000));
+  }
+  std::cout << "copy_make_filtration_non_decreasing_and_prune - " << simplices.size() << " simplices" << std::endl;
+
+  typeST st_copy(st);
+  BOOST_CHECK(st_copy == st);
+  BOOST_CHECK(st_copy.num_simplices() == simplices.size());
+
+  // The filtration value of a simplex becomes the maximum of the ones of its faces
+  typedef typename typeST::Filtration_value Filtration_value;
+  std::vector<Filtration_value> expected;
+  for (auto& simplex : simplices) {
+    Filtration_value value = 0.;
+    for (unsigned mask = 1; mask < (1u << simplex.size()); ++mask) {
+      std::vector<int> face;
+      for (std::size_t idx = 0; idx < simplex.size(); ++idx)
+        if (mask & (1u << idx)) face.push_back(simplex[idx]);
+      value = std::max(value, st.filtration(st.find(face)));
+    }
+    expected.push_back(value);
+  }
+  BOOST_CHECK(st_copy.make_filtration_non_decreasing());
+  BOOST_CHECK(!st_copy.make_filtration_non_decreasing());
+  for (std::size_t idx = 0; idx < simplices.size(); ++idx)
+    BOOST_CHECK(st_copy.filtration(st_copy.find(simplices[idx])) == expected[idx]);
+
+  const Filtration_value threshold = 900.;
+  std::size_t num_kept = std::count_if(expected.begin(), expected.end(),
+                                       [=](Filtration_value f) { return f <= threshold; });
+  BOOST_CHECK(st_copy.prune_above_filtration(threshold));
+  BOOST_CHECK(st_copy.num_simplices() == num_kept);
+  for (std::size_t idx = 0; idx < simplices.size(); ++idx)
+    BOOST_CHECK((st_copy.find(simplices[idx]) != st_copy.null_simplex()) == (expected[idx] <= threshold));
+  BOOST_CHECK(!st_copy.prune_above_filtration(threshold));
+}
+
 
 typedef boost::mpl::list<boost::adjacency_list<boost::setS, boost::vecS, boost::directedS,
                                                boost::property<vertex_filtration_t, double>,
@@ -988,3 +1057,367 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(insert_duplicated_vertices, typeST, list_of_tested
   BOOST_CHECK(st.num_simplices() == st.num_vertices() + 1);
 
 }
+
+template<class Stree>
+std::vector<std::pair<std::vector<typename Stree::Vertex_handle>, typename Stree::Filtration_value>>
+filtration_sequence(Stree& st) {
+  std::vector<std::pair<std::vector<typename Stree::Vertex_handle>, typename Stree::Filtration_value>> sequence;
+  for (auto sh : st.filtration_simplex_range())
+    sequence.emplace_back(std::vector<typename Stree::Vertex_handle>(st.simplex_vertex_range(sh).begin(),
+                                                                     st.simplex_vertex_range(sh).end()),
+                          st.filtration(sh));
+  return sequence;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(update_filtration, typeST, list_of_tested_variants) {
+  typeST st;
+  st.insert_simplex_and_subfaces({0, 1, 2}, 3.);
+  st.insert_simplex_and_subfaces({1, 2, 3}, 2.);
+  st.insert_simplex_and_subfaces({3, 4}, 1.);
+  st.insert_simplex_and_subfaces({5}, 0.);
+
+  // Without previous order, everything is sorted
+  st.update_filtration();
+  typeST st_ref(st);
+  st_ref.initialize_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+  std::size_t idx = 0;
+  for (auto sh : st.filtration_simplex_range())
+    BOOST_CHECK(st.key(sh) == idx++);
+
+  // Insertions, removal and modification of a filtration value
+  st.insert_simplex_and_subfaces({0, 4, 5}, 2.5);
+  st.insert_simplex_and_subfaces({1, 3, 6}, 0.5);
+  st.remove_maximal_simplex(st.find({0, 1, 2}));
+  st.assign_filtration(st.find({3, 4}), 1.5);
+  st.update_filtration();
+  st_ref = st;
+  st_ref.initialize_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+  idx = 0;
+  for (auto sh : st.filtration_simplex_range())
+    BOOST_CHECK(st.key(sh) == idx++);
+
+  // Nothing changed
+  st.update_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+
+  // Keys that do not match the previous order
+  for (auto sh : st.complex_simplex_range())
+    st.assign_key(sh, 0);
+  st.update_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(initialize_filtration_with_buckets, typeST, list_of_tested_variants) {
+  typeST st;
+  // Few distinct filtration values, lots of ties, and vertices that are not 0..n-1 when allowed
+  const int stride = typeST::Options::contiguous_vertices ? 1 : 3;
+  for (int i = 0; i < 30; ++i) {
+    std::vector<typename typeST::Vertex_handle> simplex;
+    for (int j = 0; j < 4; ++j)
+      simplex.push_back(static_cast<typename typeST::Vertex_handle>(stride * ((7 * i + 5 * j * j) % 23)));
+    st.insert_simplex_and_subfaces(simplex, static_cast<typename typeST::Filtration_value>(i % 4));
+  }
+  // More vertices than the integer keys can hold
+  std::vector<typename typeST::Vertex_handle> big_simplex;
+  for (int j = 0; j < 11; ++j)
+    big_simplex.push_back(static_cast<typename typeST::Vertex_handle>(stride * 2 * j));
+  st.insert_simplex_and_subfaces(big_simplex, 2);
+  st.make_filtration_non_decreasing();
+
+  typeST st_ref(st);
+  st_ref.initialize_filtration(0);
+  st.initialize_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+
+  // Too many distinct values, the comparison sort is used
+  st.initialize_filtration(2);
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(insert_sorted_simplices, typeST, list_of_tested_variants) {
+  typedef typename typeST::Vertex_handle Vertex_handle;
+  typedef typename typeST::Filtration_value Filtration_value;
+  typeST st_ref;
+  st_ref.insert_simplex_and_subfaces({0, 1, 2, 3}, 2.);
+  st_ref.insert_simplex_and_subfaces({1, 4}, 1.);
+  st_ref.insert_simplex_and_subfaces({2, 3, 5}, 3.);
+  st_ref.insert_simplex_and_subfaces({6}, 0.);
+
+  std::vector<std::pair<std::vector<Vertex_handle>, Filtration_value>> simplices;
+  for (auto sh : st_ref.complex_simplex_range()) {
+    std::vector<Vertex_handle> simplex(st_ref.simplex_vertex_range(sh).begin(), st_ref.simplex_vertex_range(sh).end());
+    std::reverse(simplex.begin(), simplex.end());
+    simplices.emplace_back(simplex, st_ref.filtration(sh));
+  }
+  std::sort(simplices.begin(), simplices.end());
+
+  typeST st;
+  st.insert_sorted_simplices(simplices);
+  BOOST_CHECK(st == st_ref);
+  BOOST_CHECK(st.dimension() == 3);
+
+  // Not after the last simplex, or with a missing facet: nothing is inserted
+  BOOST_CHECK(st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{2, 4}, 4.) == st.null_simplex());
+  BOOST_CHECK(st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{6, 7, 8}, 4.) == st.null_simplex());
+  BOOST_CHECK(st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{6}, 4.) == st.null_simplex());
+  BOOST_CHECK(st == st_ref);
+
+  // The facet {7} comes after {6, 7}
+  auto sh = st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{6, 7}, 4.);
+  BOOST_CHECK(sh != st.null_simplex());
+  BOOST_CHECK(st.filtration(sh) == 4.);
+  BOOST_CHECK(st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{7}, 4.) != st.null_simplex());
+  BOOST_CHECK(st.append_simplex_in_lexicographic_order(std::vector<Vertex_handle>{6, 7}, 4.) == st.null_simplex());
+  BOOST_CHECK(st.num_simplices() == st_ref.num_simplices() + 2);
+
+  typeST st_unsorted;
+  std::swap(simplices.front(), simplices.back());
+  BOOST_CHECK_THROW(st_unsorted.insert_sorted_simplices(simplices), std::invalid_argument);
+}
+
+struct Simplex_tree_options_link_nodes_arena : Simplex_tree_options_link_nodes {
+  static const bool arena_allocation = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<Simplex_tree_options_link_nodes>,
+                         Simplex_tree<Simplex_tree_options_link_nodes_arena>> list_of_linked_variants;
+
+template<class Stree>
+std::vector<std::vector<int>> sorted_cofaces(Stree& st, const std::vector<int>& simplex, int codimension) {
+  std::vector<std::vector<int>> cofaces;
+  for (auto sh : st.cofaces_simplex_range(st.find(simplex), codimension))
+    cofaces.emplace_back(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+  std::sort(cofaces.begin(), cofaces.end());
+  return cofaces;
+}
+
+// Compares the cofaces, found through the lists of nodes with the same label, with the ones found by a traversal.
+template<class Stree>
+void check_cofaces_with_reference(Stree& st, Simplex_tree<>& st_ref) {
+  BOOST_CHECK(st.num_simplices() == st_ref.num_simplices());
+  for (auto sh : st_ref.complex_simplex_range()) {
+    std::vector<int> simplex(st_ref.simplex_vertex_range(sh).begin(), st_ref.simplex_vertex_range(sh).end());
+    for (int codimension = 0; codimension <= 3; ++codimension)
+      BOOST_CHECK(sorted_cofaces(st, simplex, codimension) == sorted_cofaces(st_ref, simplex, codimension));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(cofaces_with_linked_nodes, typeST, list_of_linked_variants) {
+  typeST st;
+  Simplex_tree<> st_ref;
+  for (int i = 0; i < 40; ++i) {
+    std::vector<int> simplex{(7 * i) % 17, (5 * i + 3) % 17, (i * i) % 17, (3 * i + 1) % 17};
+    st.insert_simplex_and_subfaces(simplex, i % 5);
+    st_ref.insert_simplex_and_subfaces(simplex, i % 5);
+  }
+  // Inserts the vertex 20 on the way
+  st.insert_simplex({20, 21}, 1.);
+  st_ref.insert_simplex({20, 21}, 1.);
+  check_cofaces_with_reference(st, st_ref);
+
+  // Removals move the nodes in their siblings
+  for (int v : {3, 9, 14}) {
+    std::vector<int> vertex{v};
+    auto star = st_ref.star_simplex_range(st_ref.find(vertex));
+    for (auto sh : star) {
+      if (!st_ref.has_children(sh)) {
+        std::vector<int> simplex(st_ref.simplex_vertex_range(sh).begin(), st_ref.simplex_vertex_range(sh).end());
+        st.remove_maximal_simplex(st.find(simplex));
+        st_ref.remove_maximal_simplex(sh);
+        break;
+      }
+    }
+  }
+  st.prune_above_filtration(3.);
+  st_ref.prune_above_filtration(3.);
+  check_cofaces_with_reference(st, st_ref);
+
+  // Copy, move and serialization
+  typeST st_copy(st);
+  check_cofaces_with_reference(st_copy, st_ref);
+  typeST st_move(std::move(st_copy));
+  check_cofaces_with_reference(st_move, st_ref);
+  st_copy = st_move;
+  st_move = std::move(st);
+  check_cofaces_with_reference(st_copy, st_ref);
+  check_cofaces_with_reference(st_move, st_ref);
+  std::vector<char> buffer(st_move.get_serialization_size());
+  st_move.serialize(buffer.data(), buffer.size());
+  typeST st_deserialized;
+  st_deserialized.deserialize(buffer.data(), buffer.size());
+  check_cofaces_with_reference(st_deserialized, st_ref);
+
+  // Expansion of a graph
+  typeST st_graph;
+  Simplex_tree<> st_graph_ref;
+  for (int u = 0; u < 12; ++u) {
+    for (int v = u + 1; v < 12; ++v) {
+      if ((u * v) % 5 != 1) {
+        st_graph.insert_simplex_and_subfaces({u, v}, u + v);
+        st_graph_ref.insert_simplex_and_subfaces({u, v}, u + v);
+      }
+    }
+  }
+  st_graph.expansion(4);
+  st_graph_ref.expansion(4);
+  check_cofaces_with_reference(st_graph, st_graph_ref);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(memory_usage_and_shrink_to_fit, typeST, list_of_tested_variants) {
+  typedef typename typeST::Dictionary::value_type Node_value;
+  typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS,
+                                boost::property<vertex_filtration_t, typename typeST::Filtration_value>,
+                                boost::property<edge_filtration_t, typename typeST::Filtration_value>> Graph;
+  std::vector<std::pair<int, int>> edges;
+  for (int u = 0; u < 15; ++u)
+    for (int v = u + 1; v < 15; ++v)
+      if ((u * v + u) % 4 != 1) edges.emplace_back(u, v);
+  std::vector<typename typeST::Filtration_value> edge_filtrations(edges.size(), 1.);
+  Graph graph(edges.begin(), edges.end(), edge_filtrations.begin(), 15);
+  for (int v = 0; v < 15; ++v)
+    boost::put(vertex_filtration_t(), graph, v, 0.);
+
+  typeST st;
+  st.insert_graph(graph);
+  st.expansion(4);
+  st.initialize_filtration();
+  typeST st_copy(st);
+
+  auto usage = st.memory_usage();
+  BOOST_CHECK(usage.nodes.size() == static_cast<std::size_t>(st.dimension() + 1));
+  std::size_t num_nodes = 0;
+  for (std::size_t dim = 0; dim < usage.nodes.size(); ++dim) {
+    BOOST_CHECK(usage.nodes[dim] % sizeof(Node_value) == 0);
+    num_nodes += usage.nodes[dim] / sizeof(Node_value);
+  }
+  BOOST_CHECK(num_nodes == st.num_simplices());
+  BOOST_CHECK(usage.nodes[0] == st.num_vertices() * sizeof(Node_value));
+  BOOST_CHECK(usage.siblings[0] == 0);
+  BOOST_CHECK(usage.siblings[1] > 0);
+  BOOST_CHECK(usage.filtration_vector >= st.num_simplices() * sizeof(typename typeST::Simplex_handle));
+  BOOST_CHECK(usage.total() > usage.nodes[1] + usage.nodes[2]);
+
+  st.shrink_to_fit();
+  BOOST_CHECK(st == st_copy);
+  auto shrunk_usage = st.memory_usage();
+  BOOST_CHECK(shrunk_usage.nodes == usage.nodes);
+  BOOST_CHECK(shrunk_usage.filtration_vector == 0);
+  BOOST_CHECK(shrunk_usage.unused_capacity[0] == 0);
+  if (!typeST::Options::arena_allocation) {
+    for (std::size_t unused : shrunk_usage.unused_capacity)
+      BOOST_CHECK(unused == 0);
+    BOOST_CHECK(shrunk_usage.total() < usage.total());
+  }
+  // Usable as before
+  st.initialize_filtration();
+  BOOST_CHECK(std::distance(st.filtration_simplex_range().begin(), st.filtration_simplex_range().end()) ==
+              static_cast<std::ptrdiff_t>(st.num_simplices()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(boundary_keys, typeST, list_of_tested_variants) {
+  typeST st;
+  const int stride = typeST::Options::contiguous_vertices ? 1 : 3;
+  for (int i = 0; i < 12; ++i)
+    st.insert_simplex_and_subfaces({stride * i, stride * ((i + 1) % 12), stride * ((i + 5) % 12),
+                                    stride * ((i + 7) % 12)}, (i * 7) % 5);
+  st.insert_simplex_and_subfaces({stride * 12}, 0.);
+  BOOST_CHECK(!st.has_boundary_keys());
+  BOOST_CHECK(st.memory_usage().boundary_keys == 0);
+
+  st.initialize_boundary_keys();
+  BOOST_CHECK(st.has_boundary_keys());
+  std::size_t idx = 0, num_keys = 0;
+  for (auto sh : st.filtration_simplex_range()) {
+    BOOST_CHECK(st.key(sh) == idx);
+    std::vector<typename typeST::Simplex_key> keys;
+    for (auto b_sh : st.boundary_simplex_range(sh))
+      keys.push_back(st.key(b_sh));
+    if (st.dimension(sh) == 0) keys.clear();
+    auto cached = st.boundary_keys(st.key(sh));
+    BOOST_CHECK(std::vector<typename typeST::Simplex_key>(cached.begin(), cached.end()) == keys);
+    // Faces come first in the filtration
+    for (auto k : cached)
+      BOOST_CHECK(k < idx);
+    num_keys += keys.size();
+    ++idx;
+  }
+  BOOST_CHECK(st.memory_usage().boundary_keys >= num_keys * sizeof(typename typeST::Simplex_key));
+
+  // Moved with the tree, dropped with the filtration
+  typeST st_moved(std::move(st));
+  BOOST_CHECK(st_moved.has_boundary_keys());
+  BOOST_CHECK(!st.has_boundary_keys());
+  typeST st_copy(st_moved);
+  BOOST_CHECK(!st_copy.has_boundary_keys());
+  st_moved.initialize_filtration();
+  BOOST_CHECK(!st_moved.has_boundary_keys());
+  st_moved.initialize_boundary_keys();
+  st_moved.clear_boundary_keys();
+  BOOST_CHECK(!st_moved.has_boundary_keys());
+  BOOST_CHECK(st_moved.memory_usage().boundary_keys == 0);
+}
+
+struct Simplex_tree_options_packed_persistence : Simplex_tree_options_fast_persistence {
+  static const bool packed_nodes = true;
+};
+
+BOOST_AUTO_TEST_CASE(packed_nodes_layout) {
+  typedef Simplex_tree<Simplex_tree_options_fast_persistence> Unpacked;
+  typedef Simplex_tree<Simplex_tree_options_packed_persistence> Packed;
+  // Vertex, filtration value, key and children index
+  BOOST_CHECK(sizeof(Packed::Dictionary::value_type) == 4 * sizeof(std::uint32_t));
+  BOOST_CHECK(sizeof(Packed::Dictionary::value_type) < sizeof(Unpacked::Dictionary::value_type));
+
+  Unpacked st_ref;
+  Packed st;
+  for (int u = 0; u < 20; ++u) {
+    st_ref.insert_simplex({u}, 0.f);
+    st.insert_simplex({u}, 0.f);
+    for (int v = u + 1; v < 20; ++v) {
+      if ((u * v + u + v) % 5 != 1) {
+        st_ref.insert_simplex({u, v}, static_cast<float>((u + 2 * v) % 7));
+        st.insert_simplex({u, v}, static_cast<float>((u + 2 * v) % 7));
+      }
+    }
+  }
+  st_ref.expansion(4);
+  st.expansion(4);
+  BOOST_CHECK(st.num_simplices() == st_ref.num_simplices());
+  BOOST_CHECK(st.dimension() == st_ref.dimension());
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<int> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    std::size_t num_facets = 0;
+    for (auto b_sh : st.boundary_simplex_range(sh)) {
+      std::vector<int> facet(st.simplex_vertex_range(b_sh).begin(), st.simplex_vertex_range(b_sh).end());
+      BOOST_CHECK(std::includes(simplex.rbegin(), simplex.rend(), facet.rbegin(), facet.rend()));
+      ++num_facets;
+    }
+    BOOST_CHECK(num_facets == (simplex.size() == 1 ? 0 : simplex.size()));
+  }
+  auto usage = st.memory_usage();
+  BOOST_CHECK(usage.nodes[0] == st.num_vertices() * sizeof(Packed::Dictionary::value_type));
+  BOOST_CHECK(usage.siblings_pool > 0);
+
+  // Removals free indices that are reused by the next insertions
+  Packed st_copy(st);
+  BOOST_CHECK(st_copy == st);
+  st.prune_above_filtration(3.f);
+  st_ref.prune_above_filtration(3.f);
+  st.insert_simplex_and_subfaces({0, 1, 2, 3, 4}, 6.f);
+  st_ref.insert_simplex_and_subfaces({0, 1, 2, 3, 4}, 6.f);
+  st.initialize_filtration();
+  st_ref.initialize_filtration();
+  BOOST_CHECK(filtration_sequence(st) == filtration_sequence(st_ref));
+
+  Packed st_moved(std::move(st_copy));
+  BOOST_CHECK(st_copy.num_simplices() == 0);
+  st_copy.insert_simplex_and_subfaces({0, 1, 2}, 1.f);
+  BOOST_CHECK(st_copy.num_simplices() == 7);
+  st_copy = std::move(st_moved);
+  st_moved = st;
+  BOOST_CHECK(st_moved == st);
+  BOOST_CHECK(st_copy.num_simplices() > st.num_simplices());
+}
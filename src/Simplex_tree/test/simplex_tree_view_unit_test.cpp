@@ -0,0 +1,197 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <stdexcept>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_view"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Simplex_tree_view.h>
+#include <gudhi/Persistent_cohomology.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+using namespace Gudhi;
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+
+typedef std::vector<std::tuple<int, double, double>> Intervals;
+
+const std::vector<double> thresholds = {-1., 0., 2., 4.5, 7., 9., 12., 100.};
+
+// Edges of 10 vertices with scattered filtration values, expanded to dimension 3.
+template<class Stree>
+void build_test_complex(Stree& st) {
+  for (int u = 0; u < 10; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = u + 1; v < 10; ++v)
+      if ((u * 7 + v * 3) % 5 != 0)
+        st.insert_simplex({u, v}, static_cast<double>((u * 7 + v * 13) % 12));
+  }
+  st.expansion(3);
+}
+
+template<class Complex>
+std::vector<std::vector<int>> filtration_vertices(Complex& cpx, int max_dim) {
+  std::vector<std::vector<int>> simplices;
+  for (auto sh : cpx.filtration_simplex_range())
+    if (cpx.dimension(sh) <= max_dim)
+      simplices.emplace_back(cpx.simplex_vertex_range(sh).begin(), cpx.simplex_vertex_range(sh).end());
+  return simplices;
+}
+
+template<class Complex>
+Intervals persistence_intervals(Complex& cpx) {
+  persistent_cohomology::Persistent_cohomology<Complex, persistent_cohomology::Field_Zp> pcoh(cpx);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Intervals intervals;
+  for (auto pair : pcoh.get_persistent_pairs())
+    intervals.emplace_back(cpx.dimension(std::get<0>(pair)), cpx.filtration(std::get<0>(pair)),
+                           cpx.filtration(std::get<1>(pair)));
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+// The sublevel set of threshold, restricted to max_dim, as a copy of the tree.
+template<class Stree>
+Stree pruned_copy(const Stree& st, double threshold, int max_dim) {
+  Stree copy(st);
+  copy.prune_above_filtration(threshold);
+  // Handles are invalidated by the removals, the simplices are found again by their vertices, cofaces first
+  std::vector<std::vector<int>> too_high;
+  for (auto sh : copy.complex_simplex_range())
+    if (copy.dimension(sh) > max_dim)
+      too_high.emplace_back(copy.simplex_vertex_range(sh).begin(), copy.simplex_vertex_range(sh).end());
+  std::sort(too_high.begin(), too_high.end(),
+            [](const std::vector<int>& a, const std::vector<int>& b) { return a.size() > b.size(); });
+  for (auto& simplex : too_high)
+    copy.remove_maximal_simplex(copy.find(simplex));
+  copy.initialize_filtration();
+  return copy;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_view_structure, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  st.update_filtration();
+
+  for (int max_dim : {3, 1, 0}) {
+    for (double threshold : thresholds) {
+      Simplex_tree_view<typeST> view(st, threshold, max_dim);
+      typeST copy = pruned_copy(st, threshold, max_dim);
+
+      BOOST_CHECK(view.num_simplices() == copy.num_simplices());
+      BOOST_CHECK(filtration_vertices(view, max_dim) == filtration_vertices(copy, max_dim));
+      int dim = -1;
+      for (auto sh : copy.complex_simplex_range())
+        dim = std::max(dim, copy.dimension(sh));
+      BOOST_CHECK(view.dimension() == dim);
+
+      std::size_t idx = 0;
+      for (auto sh : view.filtration_simplex_range()) {
+        BOOST_CHECK(view.contains(sh));
+        BOOST_CHECK(view.key(sh) == idx);
+        BOOST_CHECK(view.simplex(idx) == sh);
+        BOOST_CHECK(view.filtration(sh) <= threshold);
+        ++idx;
+      }
+      std::size_t num_vertices = 0;
+      for (auto sh : view.skeleton_simplex_range(0)) {
+        BOOST_CHECK(view.dimension(sh) == 0);
+        ++num_vertices;
+      }
+      BOOST_CHECK(num_vertices == copy.num_vertices());
+      BOOST_CHECK(view.has_boundary_keys() == false);
+    }
+  }
+  // The views read the tree without modifying the keys
+  std::size_t idx = 0;
+  for (auto sh : st.filtration_simplex_range())
+    BOOST_CHECK(st.key(sh) == idx++);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_view_persistence, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  st.update_filtration();
+
+  for (int max_dim : {3, 1}) {
+    std::vector<Intervals> copy_intervals;
+    for (double threshold : thresholds) {
+      typeST copy = pruned_copy(st, threshold, max_dim);
+      copy_intervals.push_back(persistence_intervals(copy));
+    }
+
+    // The thresholds are swept over the same tree, at the same time when TBB is available
+    std::vector<Intervals> view_intervals(thresholds.size());
+    auto compute = [&](std::size_t i) {
+      Simplex_tree_view<typeST> view(st, thresholds[i], max_dim);
+      view_intervals[i] = persistence_intervals(view);
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), thresholds.size(), compute);
+#else
+    for (std::size_t i = 0; i < thresholds.size(); ++i)
+      compute(i);
+#endif
+    for (std::size_t i = 0; i < thresholds.size(); ++i) {
+      std::cout << "simplex_tree_view_persistence - threshold " << thresholds[i] << " - max_dim " << max_dim
+                << " - " << view_intervals[i].size() << " intervals\n";
+      BOOST_CHECK(view_intervals[i] == copy_intervals[i]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_view_with_boundary_keys, typeST, list_of_tested_variants) {
+  typeST st;
+  build_test_complex(st);
+  st.initialize_boundary_keys();
+
+  for (double threshold : thresholds) {
+    Simplex_tree_view<typeST> view(st, threshold);
+    BOOST_CHECK(view.has_boundary_keys());
+    typeST copy = pruned_copy(st, threshold, 3);
+    BOOST_CHECK(persistence_intervals(view) == persistence_intervals(copy));
+
+    // A non-empty skeleton has its own keys, the boundary keys of the tree cannot be used
+    Simplex_tree_view<typeST> skeleton(st, threshold, 1);
+    BOOST_CHECK(skeleton.num_simplices() == 0 || !skeleton.has_boundary_keys());
+    typeST skeleton_copy = pruned_copy(st, threshold, 1);
+    BOOST_CHECK(persistence_intervals(skeleton) == persistence_intervals(skeleton_copy));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(simplex_tree_view_exceptions) {
+  Simplex_tree<> st;
+  build_test_complex(st);
+  st.initialize_filtration();
+  // initialize_filtration does not assign the keys
+  BOOST_CHECK_THROW(Simplex_tree_view<Simplex_tree<>>(st, 100.), std::invalid_argument);
+  st.update_filtration();
+  Simplex_tree_view<Simplex_tree<>> view(st, 100.);
+  BOOST_CHECK(view.num_simplices() == st.num_simplices());
+  BOOST_CHECK(view.dimension() == 3);
+  BOOST_CHECK(view.filtration(view.null_simplex()) == std::numeric_limits<double>::infinity());
+
+  Simplex_tree<> empty;
+  Simplex_tree_view<Simplex_tree<>> empty_view(empty, 100.);
+  BOOST_CHECK(empty_view.num_simplices() == 0);
+  BOOST_CHECK(empty_view.dimension() == -1);
+}
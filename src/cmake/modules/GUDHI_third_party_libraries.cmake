@@ -45,6 +45,15 @@ if(WITH_GUDHI_USE_TBB)
     include(${TBB_USE_FILE})
     message("TBB found in ${TBB_LIBRARY_DIRS}")
     add_definitions(-DGUDHI_USE_TBB)
+  else()
+    # oneTBB no longer has the tbb/task_scheduler_init.h that FindTBB looks for, but it comes with a CMake package
+    find_package(TBB CONFIG QUIET)
+    if (TBB_FOUND)
+      set(TBB_LIBRARIES TBB::tbb TBB::tbbmalloc)
+      get_target_property(TBB_INCLUDE_DIRS TBB::tbb INTERFACE_INCLUDE_DIRECTORIES)
+      message("TBB ${TBB_VERSION} found with its CMake package in ${TBB_DIR}")
+      add_definitions(-DGUDHI_USE_TBB)
+    endif()
   endif()
 endif(WITH_GUDHI_USE_TBB)
 
@@ -0,0 +1,167 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Siddharth Pritam
+ *
+ *    Copyright (C) 2026 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef MONOTONIC_ARENA_H_
+#define MONOTONIC_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+namespace Gudhi {
+
+/** \private
+ * Memory is handed out by bumping a pointer inside large blocks. Deallocation does nothing, all the memory is
+ * given back at once by `release()` or by the destructor. Objects allocated in the arena must therefore either be
+ * trivially destructible or be destroyed explicitly by the user.
+ *
+ * `allocate` may be called concurrently: with TBB, each thread bumps in its own block and only the allocation of a
+ * new block is serialized.
+ */
+class Monotonic_arena {
+ public:
+  explicit Monotonic_arena(std::size_t block_size = 1 << 20) : block_size_(block_size), allocated_bytes_(0) { }
+
+  Monotonic_arena(const Monotonic_arena&) = delete;
+  Monotonic_arena& operator=(const Monotonic_arena&) = delete;
+
+  ~Monotonic_arena() {
+    release();
+  }
+
+  void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+#ifdef GUDHI_USE_TBB
+    Cursor& cursor = cursors_.local();
+#else
+    Cursor& cursor = cursor_;
+#endif
+    char* p = align(cursor.current, alignment);
+    if (p == nullptr || p > cursor.end || static_cast<std::size_t>(cursor.end - p) < bytes) {
+      if (bytes + alignment > block_size_ / 4) {
+        // Big requests get their own block, the current block remains usable.
+        return align(new_block(bytes + alignment), alignment);
+      }
+      cursor.current = new_block(block_size_);
+      cursor.end = cursor.current + block_size_;
+      p = align(cursor.current, alignment);
+    }
+    cursor.current = p + bytes;
+    return p;
+  }
+
+  /** Gives back all the memory. Every pointer obtained from the arena becomes invalid. */
+  void release() {
+    for (char* block : blocks_)
+      ::operator delete(block);
+    blocks_.clear();
+    allocated_bytes_ = 0;
+#ifdef GUDHI_USE_TBB
+    cursors_.clear();
+#else
+    cursor_ = Cursor();
+#endif
+  }
+
+  /** Total size of the blocks obtained from the system. */
+  std::size_t allocated_bytes() const {
+    return allocated_bytes_;
+  }
+
+ private:
+  struct Cursor {
+    char* current = nullptr;
+    char* end = nullptr;
+  };
+
+  static char* align(char* p, std::size_t alignment) {
+    if (p == nullptr) return nullptr;
+    std::uintptr_t ip = reinterpret_cast<std::uintptr_t>(p);
+    return p + ((alignment - ip % alignment) % alignment);
+  }
+
+  char* new_block(std::size_t bytes) {
+    char* block = static_cast<char*>(::operator new(bytes));
+    std::lock_guard<std::mutex> lock(mutex_);
+    try {
+      blocks_.push_back(block);
+    } catch (...) {
+      ::operator delete(block);
+      throw;
+    }
+    allocated_bytes_ += bytes;
+    return block;
+  }
+
+  std::size_t block_size_;
+  std::size_t allocated_bytes_;
+  std::vector<char*> blocks_;
+  std::mutex mutex_;
+#ifdef GUDHI_USE_TBB
+  tbb::enumerable_thread_specific<Cursor> cursors_;
+#else
+  Cursor cursor_;
+#endif
+};
+
+/** \private
+ * Allocator taking its memory from a `Monotonic_arena`. A default constructed allocator has no arena and falls
+ * back to `operator new` and `operator delete`.
+ */
+template <class T>
+class Arena_allocator {
+ public:
+  typedef T value_type;
+  template <class U> struct rebind {
+    typedef Arena_allocator<U> other;
+  };
+
+  Arena_allocator() noexcept : arena_(nullptr) { }
+  explicit Arena_allocator(Monotonic_arena* arena) noexcept : arena_(arena) { }
+  template <class U>
+  Arena_allocator(const Arena_allocator<U>& other) noexcept : arena_(other.arena()) { }
+
+  T* allocate(std::size_t n) {
+    if (arena_ == nullptr)
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, std::size_t) noexcept {
+    if (arena_ == nullptr)
+      ::operator delete(p);
+  }
+
+  Monotonic_arena* arena() const noexcept {
+    return arena_;
+  }
+
+ private:
+  Monotonic_arena* arena_;
+};
+
+template <class T, class U>
+bool operator==(const Arena_allocator<T>& a, const Arena_allocator<U>& b) noexcept {
+  return a.arena() == b.arena();
+}
+
+template <class T, class U>
+bool operator!=(const Arena_allocator<T>& a, const Arena_allocator<U>& b) noexcept {
+  return a.arena() != b.arena();
+}
+
+}  // namespace Gudhi
+
+#endif  // MONOTONIC_ARENA_H_